@@ -0,0 +1,102 @@
+#ifndef ACTION_HELPERS_H_INCLUDED
+#define ACTION_HELPERS_H_INCLUDED
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include "Stockpile.h"
+#include "Zones.h"
+
+/**
+ * Injects action packets through Ashita's packet manager.
+ */
+class PacketManagerSink final : public IActionSink
+{
+    IAshitaCore* core;
+
+public:
+    PacketManagerSink(IAshitaCore* _core)
+        : core(_core)
+    {}
+
+    bool Inject(uint16_t id, uint32_t size, uint8_t* data) override
+    {
+        // ADDING A PACKET CANNOT FAIL, THE MANAGER DROPS WHAT IT CANNOT SEND WITHOUT SAYING SO. REJECT THAT HERE INSTEAD
+        IPacketManager* packets = core != nullptr ? core->GetPacketManager() : nullptr;
+
+        if (packets == nullptr || !Sendable(id, size, data))
+        {
+            return false;
+        }
+
+        packets->AddOutgoingPacket(id, size, data);
+        return true;
+    }
+};
+
+void Stockpile::ActionsInitialize()
+{
+    action_sink = std::make_unique<PacketManagerSink>(m_AshitaCore);
+}
+
+/**
+ * Queues a typed action against an entity and sends it right away if its rate limit allows.
+ */
+void Stockpile::QueueAction(Action action, int index)
+{
+    if (index < 0)
+    {
+        return;
+    }
+
+    actions.Push(action, entity->GetServerId(index), uint16_t(index));
+
+    if (action == Action::Engage)
+    {
+        if (use_packet_actions)
+        {
+            metrics.Reactions().Emit(Reaction::EngagePacket, tick_ms, index);
+        }
+        else
+        {
+            metrics.Reactions().Emit(Reaction::EngageCommand, tick_ms, index);
+            metrics.Reactions().Emit(Reaction::CommandToPacket, tick_ms, index);
+        }
+    }
+
+    FlushActions();
+}
+
+void Stockpile::FlushActions()
+{
+    if (actions.Pending() == 0)
+    {
+        return;
+    }
+
+    uint32_t fallbacks = 0;
+
+    // CHAT COMMANDS ARE THE FALLBACK WHEN PACKET ACTIONS ARE OFF OR FAIL
+    const uint32_t sent = actions.Flush(use_packet_actions ? action_sink.get() : nullptr, tick_ms, [this, &fallbacks](const ActionQueue::Entry& entry)
+    {
+        fallbacks++;
+
+        switch (entry.action)
+        {
+        case Action::Engage:
+            QueueCommand(-1, "/attack");
+            break;
+        case Action::Disengage:
+            QueueCommand(-1, "/attack off");
+            break;
+        default:
+            break;
+        }
+    });
+
+    // FALLBACKS ARE COUNTED BY QueueCommand
+    metrics.Sent(sent - fallbacks);
+}
+
+#endif // ACTION_HELPERS_H_INCLUDED
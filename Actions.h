@@ -0,0 +1,219 @@
+#ifndef ACTIONS_H_INCLUDED
+#define ACTIONS_H_INCLUDED
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "PacketLayouts.h"
+
+/**
+ * Typed bot actions, built as outgoing packets instead of chat commands.
+ *
+ * Engage and Disengage are outgoing 0x01A (ActionRequest) packets.
+ */
+enum class Action : uint8_t
+{
+    Engage,
+    Disengage,
+    Count,
+};
+
+/**
+ * IActionSink Interface
+ *
+ * Where built action packets are injected. The plugin injects through Ashita's packet manager, anything else (ie.
+ * RecordingActionSink) can stand in for it without a game client.
+ */
+class IActionSink
+{
+public:
+    virtual ~IActionSink(void) {}
+
+    /**
+     * @return {bool} False if the packet was not queued to be sent, the caller falls back to a chat command then.
+     */
+    virtual bool Inject(uint16_t id, uint32_t size, uint8_t* data) = 0;
+
+    /**
+     * Whether a packet can be injected at all: a 9 bit id, a whole number of 4 byte words that fits the header's 7 bit
+     * size, and a header that agrees with both.
+     */
+    static bool Sendable(uint16_t id, uint32_t size, const uint8_t* data)
+    {
+        if (data == nullptr || id >= 0x200 || size < PacketHeader::Size || size > 0x7F * 4 || size % 4 != 0)
+        {
+            return false;
+        }
+
+        return PacketHeader::Id::Read(data) == id && PacketHeader::Words::Read(data) * 4u == size;
+    }
+};
+
+/**
+ * RecordingActionSink Class Implementation
+ *
+ * Records every injected packet, for running the action queue without a game client. Rejects what the packet manager
+ * would, and everything while reject is set.
+ */
+class RecordingActionSink final : public IActionSink
+{
+public:
+    struct Packet
+    {
+        uint16_t id;
+        std::vector<uint8_t> data;
+    };
+
+    std::vector<Packet> packets;
+    bool reject = false;
+
+    bool Inject(uint16_t id, uint32_t size, uint8_t* data) override
+    {
+        if (reject || !Sendable(id, size, data))
+        {
+            return false;
+        }
+
+        packets.push_back(Packet{ id, std::vector<uint8_t>(data, data + size) });
+        return true;
+    }
+};
+
+/**
+ * ActionQueue Class Implementation
+ *
+ * Fixed size queue of typed actions with a minimum interval per action type. Flush injects every action whose
+ * interval has passed through the sink, or hands it to the fallback (the chat command path) if there is no sink or
+ * the injection failed. Actions still rate limited stay queued for the next Flush. A repeat of an action that is
+ * already queued for the same target is dropped.
+ */
+class ActionQueue final
+{
+public:
+    static constexpr uint32_t Capacity = 16;
+
+    struct Entry
+    {
+        Action action;
+        uint32_t server_id;
+        uint16_t index;
+    };
+
+private:
+    std::array<Entry, Capacity> entries{};
+    uint32_t count;
+    std::array<uint64_t, size_t(Action::Count)> last{};
+    std::array<uint64_t, size_t(Action::Count)> intervals{};
+
+public:
+    ActionQueue(void)
+        : count(0)
+    {
+        intervals[size_t(Action::Engage)] = 1000;
+        intervals[size_t(Action::Disengage)] = 1000;
+    }
+    ~ActionQueue(void) {}
+
+    void SetInterval(Action action, uint64_t interval)
+    {
+        intervals[size_t(action)] = interval;
+    }
+
+    bool Push(Action action, uint32_t server_id, uint16_t index)
+    {
+        for (uint32_t n = 0; n < count; n++)
+        {
+            if (entries[n].action == action && entries[n].index == index)
+            {
+                return false;
+            }
+        }
+
+        if (count == Capacity)
+        {
+            return false;
+        }
+
+        entries[count++] = Entry{ action, server_id, index };
+
+        return true;
+    }
+
+    void Clear()
+    {
+        count = 0;
+    }
+
+    uint32_t Pending() const
+    {
+        return count;
+    }
+
+    /**
+     * Injects or falls back every queued action whose interval has passed.
+     *
+     * @param {IActionSink*} sink - The packet sink, nullptr to always use the fallback.
+     * @param {uint64_t} now - The current time in milliseconds.
+     * @param {F} fallback - Invoked as fallback(const Entry&) when the action could not be injected.
+     * @return {uint32_t} The number of actions sent.
+     */
+    template <typename F>
+    uint32_t Flush(IActionSink* sink, uint64_t now, F&& fallback)
+    {
+        uint32_t sent = 0;
+        uint32_t kept = 0;
+
+        for (uint32_t n = 0; n < count; n++)
+        {
+            const Entry& entry = entries[n];
+            uint64_t& previous = last[size_t(entry.action)];
+
+            if (previous != 0 && now - previous < intervals[size_t(entry.action)])
+            {
+                entries[kept++] = entry;
+                continue;
+            }
+
+            uint8_t buffer[ActionRequest::Size]{};
+            const uint32_t size = Build(entry, buffer);
+
+            if (sink == nullptr || !sink->Inject(ActionRequest::Id, size, buffer))
+            {
+                fallback(entry);
+            }
+
+            previous = now;
+            sent++;
+        }
+
+        count = kept;
+
+        return sent;
+    }
+
+    /**
+     * Builds the outgoing packet for an action.
+     *
+     * @return {uint32_t} The packet size.
+     */
+    static uint32_t Build(const Entry& entry, uint8_t* buffer)
+    {
+        ::memset(buffer, 0, ActionRequest::Size);
+
+        PacketWrite<ActionRequest, PacketHeader::Id>(buffer, ActionRequest::Id);
+        PacketWrite<ActionRequest, PacketHeader::Words>(buffer, ActionRequest::Size / 4);
+        PacketWrite<ActionRequest, ActionRequest::TargetId>(buffer, entry.server_id);
+        PacketWrite<ActionRequest, ActionRequest::TargetIndex>(buffer, entry.index);
+        PacketWrite<ActionRequest, ActionRequest::Category>(buffer, entry.action == Action::Engage ? 0x02 : 0x04);
+
+        return ActionRequest::Size;
+    }
+};
+
+#endif // ACTIONS_H_INCLUDED
@@ -0,0 +1,239 @@
+#ifndef AGGRO_QUEUE_H_INCLUDED
+#define AGGRO_QUEUE_H_INCLUDED
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <array>
+#include <cstdint>
+#include <utility>
+
+#include "EntityTracker.h"
+
+/**
+ * AggroQueue Class Implementation
+ *
+ * Indexed binary min-heap of the mobs that are attacking the player, keyed by distance. Every slot remembers its
+ * position in the heap, so a key can be updated or a slot removed in O(log n) without searching, and the closest
+ * attacker is popped in O(log n) the moment the current target dies.
+ *
+ * Fixed size, a slot pushed while the heap is full is dropped. (Capacity mobs on the player at once is a wipe.)
+ */
+class AggroQueue final
+{
+public:
+    static constexpr uint32_t Capacity = 64;
+
+private:
+    static constexpr uint8_t Absent = 0xFF;
+
+    struct Node
+    {
+        float key;
+        uint16_t index;
+    };
+
+    std::array<Node, Capacity> heap{};
+    std::array<uint8_t, EntityTracker::Count> position;
+    uint32_t count;
+
+public:
+    AggroQueue(void)
+        : count(0)
+    {
+        position.fill(Absent);
+    }
+    ~AggroQueue(void) {}
+
+    /**
+     * Adds a slot, or moves it if it is already queued.
+     *
+     * @return {bool} True if the slot is queued, false if the heap is full.
+     */
+    bool Push(uint16_t index, float key)
+    {
+        if (position[index] != Absent)
+        {
+            const uint32_t at = position[index];
+            const float old = heap[at].key;
+
+            heap[at].key = key;
+
+            if (key < old)
+            {
+                Up(at);
+            }
+            else
+            {
+                Down(at);
+            }
+
+            return true;
+        }
+
+        if (count == Capacity)
+        {
+            return false;
+        }
+
+        heap[count] = Node{ key, index };
+        position[index] = uint8_t(count);
+        Up(count++);
+
+        return true;
+    }
+
+    void Remove(uint16_t index)
+    {
+        if (position[index] == Absent)
+        {
+            return;
+        }
+
+        const uint32_t at = position[index];
+
+        position[index] = Absent;
+
+        if (at == --count)
+        {
+            return;
+        }
+
+        heap[at] = heap[count];
+        position[heap[at].index] = uint8_t(at);
+
+        Up(at);
+        Down(position[heap[at].index]);
+    }
+
+    /**
+     * @return {int} The closest queued slot, -1 if the queue is empty.
+     */
+    int Pop()
+    {
+        if (count == 0)
+        {
+            return -1;
+        }
+
+        const uint16_t index = heap[0].index;
+
+        Remove(index);
+
+        return index;
+    }
+
+    int Top() const
+    {
+        return count != 0 ? heap[0].index : -1;
+    }
+
+    bool Contains(uint16_t index) const
+    {
+        return position[index] != Absent;
+    }
+
+    /**
+     * Removes every queued slot keep(index) returns false for.
+     */
+    template <typename F>
+    void Retain(F&& keep)
+    {
+        uint32_t kept = 0;
+
+        for (uint32_t n = 0; n < count; n++)
+        {
+            if (keep(uint32_t(heap[n].index)))
+            {
+                heap[kept++] = heap[n];
+            }
+            else
+            {
+                position[heap[n].index] = Absent;
+            }
+        }
+
+        count = kept;
+
+        // REBUILD THE HEAP BOTTOM UP
+        for (uint32_t n = 0; n < count; n++)
+        {
+            position[heap[n].index] = uint8_t(n);
+        }
+
+        for (uint32_t n = count / 2; n-- > 0;)
+        {
+            Down(n);
+        }
+    }
+
+    uint32_t Size() const
+    {
+        return count;
+    }
+
+    void Clear()
+    {
+        for (uint32_t n = 0; n < count; n++)
+        {
+            position[heap[n].index] = Absent;
+        }
+
+        count = 0;
+    }
+
+private:
+    void Up(uint32_t at)
+    {
+        while (at > 0)
+        {
+            const uint32_t parent = (at - 1) / 2;
+
+            if (!(heap[at].key < heap[parent].key))
+            {
+                break;
+            }
+
+            Swap(at, parent);
+            at = parent;
+        }
+    }
+
+    void Down(uint32_t at)
+    {
+        for (;;)
+        {
+            const uint32_t left = at * 2 + 1;
+            const uint32_t right = left + 1;
+            uint32_t smallest = at;
+
+            if (left < count && heap[left].key < heap[smallest].key)
+            {
+                smallest = left;
+            }
+
+            if (right < count && heap[right].key < heap[smallest].key)
+            {
+                smallest = right;
+            }
+
+            if (smallest == at)
+            {
+                break;
+            }
+
+            Swap(at, smallest);
+            at = smallest;
+        }
+    }
+
+    void Swap(uint32_t a, uint32_t b)
+    {
+        std::swap(heap[a], heap[b]);
+        position[heap[a].index] = uint8_t(a);
+        position[heap[b].index] = uint8_t(b);
+    }
+};
+
+#endif // AGGRO_QUEUE_H_INCLUDED
@@ -0,0 +1,76 @@
+#ifndef ALLOCATION_HELPERS_H_INCLUDED
+#define ALLOCATION_HELPERS_H_INCLUDED
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include "Stockpile.h"
+#include "Zones.h"
+
+#include <cstdlib>
+#include <new>
+
+#if defined(_DEBUG)
+
+std::array<std::atomic<uint32_t>, size_t(Subsystem::Count)> Allocations::counts{};
+thread_local Subsystem Allocations::current = Subsystem::None;
+
+void* operator new(std::size_t size)
+{
+    Allocations::counts[size_t(Allocations::current)].fetch_add(1, std::memory_order_relaxed);
+
+    if (void* p = std::malloc(size ? size : 1))
+    {
+        return p;
+    }
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+#endif
+
+/**
+ * Debug builds: once the bot has been running long enough to be in steady state, any heap allocation made by the
+ * frame path (everything but the GUI) is reported, once per subsystem. Steady state botting must not allocate.
+ *
+ * tools/AllocCheck.cpp runs a model of the frame path over replayed input without a game client, and fails on any
+ * allocation. It shares the packet handlers and helper classes, the frame around them is kept by hand.
+ */
+void Stockpile::CheckAllocations()
+{
+#if defined(_DEBUG)
+    if (!running)
+    {
+        steady_frames = 0;
+        return;
+    }
+
+    bool steady = ++steady_frames > 300;
+
+    for (size_t n = size_t(Subsystem::Entities); n < size_t(Subsystem::Gui); n++)
+    {
+        const uint32_t count = Allocations::Count(Subsystem(n));
+
+        if (steady && count != allocations_seen[n] && !allocations_reported[n])
+        {
+            allocations_reported[n] = true;
+            Log(std::format("Steady state heap allocation in {}. ({} this frame)", SubsystemNames[n], count - allocations_seen[n]));
+        }
+
+        allocations_seen[n] = count;
+    }
+#endif
+}
+
+#endif // ALLOCATION_HELPERS_H_INCLUDED
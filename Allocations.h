@@ -0,0 +1,80 @@
+#ifndef ALLOCATIONS_H_INCLUDED
+#define ALLOCATIONS_H_INCLUDED
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+/**
+ * Heap allocation accounting per subsystem. (Debug builds only.)
+ *
+ * Debug builds replace the plugin's global operator new and count every allocation against the subsystem of the
+ * innermost AllocationScope on the calling thread. Release builds compile the scopes away and count nothing.
+ */
+enum class Subsystem : uint8_t
+{
+    None,
+    Entities,
+    Targeting,
+    Pathing,
+    Controls,
+    Actions,
+    Packets,
+    Gui,
+    Count,
+};
+
+static constexpr const char* SubsystemNames[] = { "None", "Entities", "Targeting", "Pathing", "Controls", "Actions", "Packets", "Gui" };
+
+#if defined(_DEBUG)
+
+struct Allocations
+{
+    static std::array<std::atomic<uint32_t>, size_t(Subsystem::Count)> counts;
+    static thread_local Subsystem current;
+
+    static uint32_t Count(Subsystem subsystem)
+    {
+        return counts[size_t(subsystem)].load(std::memory_order_relaxed);
+    }
+};
+
+class AllocationScope final
+{
+    Subsystem previous;
+
+public:
+    explicit AllocationScope(Subsystem subsystem)
+        : previous(Allocations::current)
+    {
+        Allocations::current = subsystem;
+    }
+    ~AllocationScope(void)
+    {
+        Allocations::current = previous;
+    }
+};
+
+#else
+
+struct Allocations
+{
+    static uint32_t Count(Subsystem)
+    {
+        return 0;
+    }
+};
+
+class AllocationScope final
+{
+public:
+    explicit AllocationScope(Subsystem) {}
+};
+
+#endif
+
+#endif // ALLOCATIONS_H_INCLUDED
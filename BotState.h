@@ -0,0 +1,36 @@
+#ifndef BOT_STATE_H_INCLUDED
+#define BOT_STATE_H_INCLUDED
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <cstdint>
+
+/**
+ * What the bot is doing. Each decision runs only the current state's tick, which either does that state's work or
+ * hands over to the next state.
+ *
+ *      Idle        Stopped, or just zoned and starting over.
+ *      Patrol      Nothing in range, following the path and looking for a target.
+ *      Acquire     Picking the closest selectable mob.
+ *      Approach    Target picked, closing to engage range around obstacles.
+ *      Engage      In engage range, selecting and attacking until locked on.
+ *      Fight       Locked on, holding attack range and facing the target.
+ *      Recover     Dead, waiting to be raised.
+ */
+enum class BotState : uint8_t
+{
+    Idle,
+    Patrol,
+    Acquire,
+    Approach,
+    Engage,
+    Fight,
+    Recover,
+    Count,
+};
+
+static constexpr const char* BotStateNames[] = { "Idle", "Patrol", "Acquire", "Approach", "Engage", "Fight", "Recover" };
+
+#endif // BOT_STATE_H_INCLUDED
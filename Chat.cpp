@@ -0,0 +1,132 @@
+#ifndef CHAT_H_INCLUDED
+#define CHAT_H_INCLUDED
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include "Stockpile.h"
+#include "Zones.h"
+
+/**
+ * Tags an incoming game message with the events the bot reacts to, lines players typed are ignored. (Render thread.)
+ *
+ * Nothing is written to the chat from here, the events are applied by ApplyChatEvents at the start of the next frame.
+ * A defeat line only counts if it names the closest target, and even then only once the target's HP or status agrees,
+ * since a camp of mobs sharing its name can be killed by anyone.
+ */
+void Stockpile::OnChatLine(int32_t mode, const char* message)
+{
+    if (decided.closest_target_id == -1)
+    {
+        return;
+    }
+
+    uint32_t events = chat_classifier.Classify(mode, message);
+
+    if ((events & ChatClassifier::Defeat) && ::strstr(message, closest_target_name) == nullptr)
+    {
+        events &= ~ChatClassifier::Defeat;
+    }
+
+    chat_events |= events;
+}
+
+/**
+ * Reacts to the chat events since the last frame. (Render thread, after the entities are updated.)
+ *
+ *  - Defeat: drops the target once this or a later frame shows it dead, the same as the defeat packet.
+ *  - Cannot see / cannot attack: drops the target and skips it for UnreachableMs.
+ *  - Too far / out of range: counted into the snapshot, the worker holds forward for a moment.
+ */
+void Stockpile::ApplyChatEvents()
+{
+    const uint32_t events = chat_events;
+    const int index = decided.closest_target_id;
+
+    chat_events = ChatClassifier::None;
+
+    // EXPIRED MARKS, THE MOB IS A CANDIDATE AGAIN EVEN IF NOTHING ABOUT IT CHANGED
+    for (Unreachable& u : unreachable)
+    {
+        if (u.until_ms != 0 && tick_ms >= u.until_ms)
+        {
+            u.until_ms = 0;
+
+            if (!entities.IsStale(u.handle))
+            {
+                UpdateCandidate(uint32_t(u.handle.index));
+            }
+        }
+    }
+
+    if (index == -1)
+    {
+        defeat_until_ms = 0;
+        return;
+    }
+
+    // A DEFEAT LINE ONLY DROPS THE TARGET ONCE THE TARGET ITSELF SHOWS DEAD, WITHIN DefeatConfirmMs
+    if (defeat_until_ms != 0 && (defeat_handle.index != index || entities.IsStale(defeat_handle) || tick_ms >= defeat_until_ms))
+    {
+        defeat_until_ms = 0;
+    }
+
+    if ((events & ChatClassifier::Defeat) && defeat_until_ms == 0)
+    {
+        defeat_handle = entities.MakeHandle(index);
+        defeat_until_ms = tick_ms + DefeatConfirmMs;
+    }
+
+    if (defeat_until_ms != 0)
+    {
+        const EntityTracker::Entry& e = entities.Get(index);
+
+        if (e.hp == 0 || e.status == 2 || e.status == 3)
+        {
+            defeat_until_ms = 0;
+            InvalidateTarget(index, "chat", "defeated");
+            return;
+        }
+    }
+
+    if (events & (ChatClassifier::CannotSee | ChatClassifier::CannotAttack))
+    {
+        Unreachable& u = unreachable[unreachable_next++ % unreachable.size()];
+        const Unreachable overwritten = u;
+
+        u = { entities.MakeHandle(index), tick_ms + UnreachableMs };
+
+        // THE OLDEST MARK IS DROPPED EARLY, ITS MOB IS A CANDIDATE AGAIN
+        if (overwritten.until_ms != 0 && !entities.IsStale(overwritten.handle))
+        {
+            UpdateCandidate(uint32_t(overwritten.handle.index));
+        }
+
+        InvalidateTarget(index, "chat", "unreachable");
+        return;
+    }
+
+    if (events & (ChatClassifier::TooFar | ChatClassifier::OutOfRange))
+    {
+        out_of_range_count++;
+    }
+}
+
+/**
+ * @return {bool} True if the chat said the mob in this slot cannot be seen or attacked, less than UnreachableMs ago.
+ */
+bool Stockpile::IsUnreachable(uint32_t index) const
+{
+    for (const Unreachable& u : unreachable)
+    {
+        if (u.handle.index == int32_t(index) && tick_ms < u.until_ms && !entities.IsStale(u.handle))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+#endif // CHAT_H_INCLUDED
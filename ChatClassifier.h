@@ -0,0 +1,199 @@
+#ifndef CHAT_CLASSIFIER_H_INCLUDED
+#define CHAT_CLASSIFIER_H_INCLUDED
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+/**
+ * ChatClassifier Class Implementation
+ *
+ * Tags incoming chat lines with the combat events the bot reacts to. Every phrase is compiled once into a single
+ * Aho-Corasick automaton with a full transition table, and every node carries the events of every phrase ending
+ * there or on its suffix chain, so classifying a line is one table lookup and one OR per byte. Nothing allocates
+ * after construction.
+ *
+ * Matching is case insensitive. Bytes that are not in any phrase (color codes, auto-translate markers) send the
+ * automaton back to the root.
+ *
+ * Lines players typed (say, shout, tell, party, linkshell, emote, ...) are never classified, only the game's own
+ * combat and system messages are, so nobody can drop the target by typing "cannot see" in /party.
+ */
+class ChatClassifier final
+{
+public:
+    enum : uint32_t
+    {
+        None = 0x00,
+        CannotSee = 0x01,       // Line of sight.
+        TooFar = 0x02,
+        OutOfRange = 0x04,
+        CannotAttack = 0x08,
+        Defeat = 0x10,
+    };
+
+    struct Phrase
+    {
+        const char* text;
+        uint32_t events;
+    };
+
+    static constexpr Phrase Phrases[] =
+    {
+        { "unable to see", CannotSee },
+        { "cannot see", CannotSee },
+        { "too far away", TooFar },
+        { "out of range", OutOfRange },
+        { "cannot attack", CannotAttack },
+        { "defeats", Defeat },
+        { "was defeated", Defeat },
+        { "falls to the ground", Defeat },
+    };
+
+private:
+    std::array<uint8_t, 256> classes{}; // Byte to alphabet class, folded to lower case. (0 = not in any phrase.)
+    int32_t alphabet = 1;
+
+    std::vector<int32_t> delta;         // Full transition table, nodes * alphabet.
+    std::vector<uint32_t> events;       // Events reported on entering each node.
+
+public:
+    ChatClassifier(void)
+    {
+        for (const Phrase& phrase : Phrases)
+        {
+            for (const char* c = phrase.text; *c != '\0'; c++)
+            {
+                if (classes[uint8_t(*c)] == 0)
+                {
+                    classes[uint8_t(*c)] = uint8_t(alphabet);
+
+                    if (*c >= 'a' && *c <= 'z')
+                    {
+                        classes[uint8_t(*c - 'a' + 'A')] = uint8_t(alphabet);
+                    }
+
+                    alphabet++;
+                }
+            }
+        }
+
+        // TRIE
+        delta.assign(alphabet, -1);
+        events.assign(1, None);
+
+        for (const Phrase& phrase : Phrases)
+        {
+            int32_t state = 0;
+
+            for (const char* c = phrase.text; *c != '\0'; c++)
+            {
+                const int32_t a = classes[uint8_t(*c)];
+
+                if (delta[state * alphabet + a] == -1)
+                {
+                    delta[state * alphabet + a] = int32_t(events.size());
+                    events.push_back(None);
+                    delta.resize(delta.size() + alphabet, -1);
+                }
+
+                state = delta[state * alphabet + a];
+            }
+
+            events[state] |= phrase.events;
+        }
+
+        // FAILURE LINKS (BFS), FOLDED INTO THE TRANSITION TABLE AND THE EVENTS
+        std::vector<int32_t> fail(events.size(), 0);
+        std::vector<int32_t> queue;
+        queue.reserve(events.size());
+
+        for (int32_t a = 0; a < alphabet; a++)
+        {
+            int32_t& next = delta[a];
+
+            if (next == -1 || a == 0)
+            {
+                next = 0;
+            }
+            else
+            {
+                queue.push_back(next);
+            }
+        }
+
+        for (size_t head = 0; head < queue.size(); head++)
+        {
+            const int32_t state = queue[head];
+            const int32_t f = fail[state];
+
+            events[state] |= events[f];
+
+            for (int32_t a = 0; a < alphabet; a++)
+            {
+                int32_t& next = delta[state * alphabet + a];
+
+                if (a == 0)
+                {
+                    next = 0;
+                }
+                else if (next == -1)
+                {
+                    next = delta[f * alphabet + a];
+                }
+                else
+                {
+                    fail[next] = delta[f * alphabet + a];
+                    queue.push_back(next);
+                }
+            }
+        }
+    }
+    ~ChatClassifier(void) {}
+
+    /**
+     * @param {int32_t} mode - The chat mode of the line, as HandleIncomingText gets it.
+     * @return {bool} True if a player typed the line.
+     */
+    static constexpr bool IsPlayerChat(int32_t mode)
+    {
+        const int32_t channel = mode & 0xFF;
+
+        // SAY, SHOUT, YELL, TELL, PARTY, LINKSHELL AND EMOTE (OURS AND OTHERS), UNITY, LINKSHELL 2, ASSIST
+        return (channel >= 1 && channel <= 15) || (channel >= 212 && channel <= 214) || (channel >= 220 && channel <= 223);
+    }
+
+    /**
+     * Classifies a game message, lines players typed report nothing.
+     */
+    uint32_t Classify(int32_t mode, std::string_view line) const
+    {
+        return IsPlayerChat(mode) ? None : Classify(line);
+    }
+
+    /**
+     * Classifies a line in a single pass.
+     *
+     * @return {uint32_t} Mask of every event a phrase in the line reports.
+     */
+    uint32_t Classify(std::string_view line) const
+    {
+        uint32_t found = None;
+        int32_t state = 0;
+
+        for (const char c : line)
+        {
+            state = delta[state * alphabet + classes[uint8_t(c)]];
+            found |= events[state];
+        }
+
+        return found;
+    }
+};
+
+#endif // CHAT_CLASSIFIER_H_INCLUDED
@@ -0,0 +1,416 @@
+#ifndef CLAIM_TABLE_H_INCLUDED
+#define CLAIM_TABLE_H_INCLUDED
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(_WIN32)
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+/**
+ * ClaimTable Class Implementation
+ *
+ * Lock-free table shared between every Stockpile instance on the host, so characters botting the same zone do not
+ * converge on the same mob. Each instance publishes an intent when it picks a target and a claim once it has the
+ * mob, and skips mobs that a sibling has reserved.
+ *
+ * Every entry is a single 64-bit word updated with compare-exchange:
+ *
+ *      zone (10) | target index (12) | owner (4) | state (2) | timestamp (36, milliseconds)
+ *
+ * Entries are keyed by zone and target index and live in a short linear probe window. If two siblings insert the
+ * same key at the same time, the live entry earliest in the window wins and the other instance backs off.
+ * Reservations expire on their own if the owner stops refreshing them. (Crash, zone, disconnect.)
+ *
+ * Timestamps come from std::chrono::steady_clock, which is system wide on both Windows and Linux.
+ */
+class ClaimTable final
+{
+public:
+    enum : uint32_t
+    {
+        Free = 0,
+        Intent = 1,
+        Claim = 2,
+    };
+
+    static constexpr uint32_t Slots = 4096;
+    static constexpr uint32_t Probe = 16;
+    static constexpr uint32_t Owners = 15;              // Owner ids 1 - 15 fit in the entry word.
+
+    static constexpr uint64_t IntentTimeout = 4000;     // Milliseconds before an unrefreshed intent expires.
+    static constexpr uint64_t ClaimTimeout = 15000;     // Milliseconds before an unrefreshed claim expires.
+    static constexpr uint64_t OwnerTimeout = 60000;     // Milliseconds before a silent owner slot can be reused.
+    static constexpr uint64_t Refresh = 1000;           // Milliseconds between refreshes of a held entry.
+
+private:
+    static constexpr uint64_t TimeMask = (uint64_t(1) << 36) - 1;
+
+    struct Shared
+    {
+        std::atomic<uint64_t> owners[Owners];   // Process id << 32 | heartbeat (seconds).
+        std::atomic<uint64_t> entries[Slots];
+    };
+
+    static_assert(std::atomic<uint64_t>::is_always_lock_free, "ClaimTable requires lock-free 64-bit atomics.");
+
+    Shared* shared;
+    uint32_t owner;
+    uint64_t process;
+
+#if defined(_WIN32)
+    HANDLE mapping;
+#endif
+
+public:
+    ClaimTable(void)
+        : shared(nullptr)
+        , owner(0)
+        , process(0)
+#if defined(_WIN32)
+        , mapping(nullptr)
+#endif
+    {}
+    ~ClaimTable(void)
+    {
+        Close();
+    }
+
+    ClaimTable(const ClaimTable&) = delete;
+    ClaimTable& operator=(const ClaimTable&) = delete;
+
+    /**
+     * Maps the shared table and registers this instance as an owner.
+     *
+     * @param {const char*} name - The mapping name. (Windows: "Local\\StockpileClaims", Linux: "/stockpile_claims")
+     * @param {uint64_t} now - The current steady clock time in milliseconds.
+     * @return {bool} True if the table is usable, false otherwise.
+     */
+    bool Open(const char* name, uint64_t now)
+    {
+        Close();
+
+#if defined(_WIN32)
+        process = ::GetCurrentProcessId();
+
+        mapping = ::CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, 0, sizeof(Shared), name);
+        if (mapping == nullptr)
+        {
+            return false;
+        }
+
+        shared = static_cast<Shared*>(::MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, sizeof(Shared)));
+        if (shared == nullptr)
+        {
+            ::CloseHandle(mapping);
+            mapping = nullptr;
+            return false;
+        }
+#else
+        process = uint64_t(::getpid());
+
+        const int fd = ::shm_open(name, O_CREAT | O_RDWR, 0600);
+        if (fd == -1)
+        {
+            return false;
+        }
+
+        if (::ftruncate(fd, sizeof(Shared)) != 0)
+        {
+            ::close(fd);
+            return false;
+        }
+
+        void* view = ::mmap(nullptr, sizeof(Shared), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        ::close(fd);
+
+        if (view == MAP_FAILED)
+        {
+            return false;
+        }
+
+        shared = static_cast<Shared*>(view);
+#endif
+
+        // REGISTER (FREE OR SILENT OWNER SLOT)
+        for (uint32_t n = 0; n < Owners; n++)
+        {
+            uint64_t current = shared->owners[n].load();
+
+            if ((current == 0 || Expired(current, now, OwnerTimeout)) && shared->owners[n].compare_exchange_strong(current, Beat(now)))
+            {
+                owner = n + 1;
+
+                // ENTRIES OF A PREVIOUS OWNER OF THIS SLOT ARE NOT OURS
+                ReleaseAll();
+
+                return true;
+            }
+        }
+
+        Close();
+
+        return false;
+    }
+
+    void Close()
+    {
+        if (shared == nullptr)
+        {
+            return;
+        }
+
+        if (owner != 0)
+        {
+            ReleaseAll();
+            shared->owners[owner - 1].store(0);
+            owner = 0;
+        }
+
+#if defined(_WIN32)
+        ::UnmapViewOfFile(shared);
+        ::CloseHandle(mapping);
+        mapping = nullptr;
+#else
+        ::munmap(shared, sizeof(Shared));
+#endif
+
+        shared = nullptr;
+    }
+
+    bool IsOpen() const
+    {
+        return shared != nullptr;
+    }
+
+    /**
+     * Publishes or refreshes an intent or claim on a target.
+     *
+     * @return {bool} True if this instance holds the target, false if a sibling has it reserved.
+     */
+    bool Reserve(uint32_t zone, uint32_t index, uint32_t state, uint64_t now)
+    {
+        if (shared == nullptr)
+        {
+            return true;
+        }
+
+        const uint64_t key = Key(zone, index);
+        const uint64_t word = key | (uint64_t(owner) << 38) | (uint64_t(state) << 36) | (now & TimeMask);
+        const uint32_t home = Home(key);
+
+        for (uint32_t attempt = 0; attempt < 4; attempt++)
+        {
+            int32_t free = -1;
+
+            for (uint32_t n = 0; n < Probe; n++)
+            {
+                std::atomic<uint64_t>& entry = shared->entries[(home + n) % Slots];
+                uint64_t current = entry.load();
+
+                if (current != 0 && (current & KeyMask()) == key && Live(current, now))
+                {
+                    if (Owner(current) != owner)
+                    {
+                        return false;
+                    }
+
+                    // OURS, ONLY WRITE WHEN STALE OR THE STATE CHANGES
+                    if (State(current) == state && Age(current, now) < Refresh)
+                    {
+                        return true;
+                    }
+
+                    if (entry.compare_exchange_strong(current, word))
+                    {
+                        return true;
+                    }
+
+                    free = -2;
+                    break;
+                }
+
+                if (free == -1 && (current == 0 || !Live(current, now)))
+                {
+                    free = int32_t(n);
+                }
+            }
+
+            if (free == -2)
+            {
+                continue;
+            }
+
+            if (free == -1)
+            {
+                // WINDOW FULL, DO NOT BLOCK TARGETING
+                return true;
+            }
+
+            std::atomic<uint64_t>& entry = shared->entries[(home + free) % Slots];
+            uint64_t current = entry.load();
+
+            if ((current != 0 && Live(current, now)) || !entry.compare_exchange_strong(current, word))
+            {
+                continue;
+            }
+
+            // A SIBLING INSERTED THE SAME KEY EARLIER IN THE WINDOW AT THE SAME TIME
+            for (uint32_t n = 0; n < uint32_t(free); n++)
+            {
+                const uint64_t other = shared->entries[(home + n) % Slots].load();
+
+                if (other != 0 && (other & KeyMask()) == key && Live(other, now) && Owner(other) != owner)
+                {
+                    uint64_t mine = word;
+                    entry.compare_exchange_strong(mine, 0);
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        return true;
+    }
+
+    /**
+     * Returns true if a sibling holds a live intent or claim on the target.
+     */
+    bool IsReserved(uint32_t zone, uint32_t index, uint64_t now) const
+    {
+        if (shared == nullptr)
+        {
+            return false;
+        }
+
+        const uint64_t key = Key(zone, index);
+        const uint32_t home = Home(key);
+
+        for (uint32_t n = 0; n < Probe; n++)
+        {
+            const uint64_t current = shared->entries[(home + n) % Slots].load();
+
+            if (current != 0 && (current & KeyMask()) == key && Live(current, now))
+            {
+                return Owner(current) != owner;
+            }
+        }
+
+        return false;
+    }
+
+    void Release(uint32_t zone, uint32_t index)
+    {
+        if (shared == nullptr)
+        {
+            return;
+        }
+
+        const uint64_t key = Key(zone, index);
+        const uint32_t home = Home(key);
+
+        for (uint32_t n = 0; n < Probe; n++)
+        {
+            std::atomic<uint64_t>& entry = shared->entries[(home + n) % Slots];
+            uint64_t current = entry.load();
+
+            if (current != 0 && (current & KeyMask()) == key && Owner(current) == owner)
+            {
+                entry.compare_exchange_strong(current, 0);
+            }
+        }
+    }
+
+    void ReleaseAll()
+    {
+        if (shared == nullptr || owner == 0)
+        {
+            return;
+        }
+
+        for (uint32_t n = 0; n < Slots; n++)
+        {
+            uint64_t current = shared->entries[n].load();
+
+            if (current != 0 && Owner(current) == owner)
+            {
+                shared->entries[n].compare_exchange_strong(current, 0);
+            }
+        }
+    }
+
+    /**
+     * Keeps this instance's owner slot alive. Cheap enough to call every frame.
+     */
+    void Heartbeat(uint64_t now)
+    {
+        if (shared == nullptr || owner == 0)
+        {
+            return;
+        }
+
+        if (Expired(shared->owners[owner - 1].load(), now, OwnerTimeout / 4))
+        {
+            shared->owners[owner - 1].store(Beat(now));
+        }
+    }
+
+private:
+    static uint64_t KeyMask()
+    {
+        return ~((uint64_t(1) << 42) - 1);
+    }
+
+    static uint64_t Key(uint32_t zone, uint32_t index)
+    {
+        return (uint64_t(zone & 0x3FF) << 54) | (uint64_t(index & 0xFFF) << 42);
+    }
+
+    static uint32_t Home(uint64_t key)
+    {
+        return uint32_t((key >> 42) * 2654435761u) % Slots;
+    }
+
+    static uint32_t Owner(uint64_t word)
+    {
+        return uint32_t(word >> 38) & 0x0F;
+    }
+
+    static uint32_t State(uint64_t word)
+    {
+        return uint32_t(word >> 36) & 0x03;
+    }
+
+    static uint64_t Age(uint64_t word, uint64_t now)
+    {
+        return (now - word) & TimeMask;
+    }
+
+    static bool Live(uint64_t word, uint64_t now)
+    {
+        return Age(word, now) < (State(word) == Claim ? ClaimTimeout : IntentTimeout);
+    }
+
+    uint64_t Beat(uint64_t now) const
+    {
+        return (process << 32) | ((now / 1000) & 0xFFFFFFFF);
+    }
+
+    static bool Expired(uint64_t heartbeat, uint64_t now, uint64_t timeout)
+    {
+        return (now / 1000 - (heartbeat & 0xFFFFFFFF)) * 1000 >= timeout;
+    }
+};
+
+#endif // CLAIM_TABLE_H_INCLUDED
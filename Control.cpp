@@ -1,59 +1,68 @@
-#ifndef CONTROL_HELPERS_H_INCLUDED
-#define CONTROL_HELPERS_H_INCLUDED
-
-#if defined(_MSC_VER) && (_MSC_VER >= 1020)
-#pragma once
-#endif
-
-#include "Stockpile.h"
-#include "Zones.h"
-
-void Stockpile::ControlsReload()
-{
-    QueueCommand(-1, std::format("/releasekeys"));
-
-    for (std::list<Control>::iterator it = controls.begin(); it != controls.end(); ++it)
-    {
-        it->SetC(false);
-        it->SetO(false);
-    }
-}
-
-void Stockpile::ControlsReset()
-{
-    for (std::list<Control>::iterator it = controls.begin(); it != controls.end(); ++it)
-    {
-        it->SetC(false);
-    }
-}
-
-void Stockpile::ControlsDown(std::string control)
-{
-    for (std::list<Control>::iterator it = controls.begin(); it != controls.end(); ++it)
-    {
-        if (it->GetControl() == control)
-        {
-            it->SetC(true);
-        }
-    }
-}
-
-void Stockpile::Controls()
-{
-    for (std::list<Control>::iterator it = controls.begin(); it != controls.end(); ++it)
-    {
-        if (it->GetC() && !it->GetO())
-        {
-            QueueCommand(-1, std::format("/sendkey {} down", it->GetControl()));
-            it->SetO(it->GetC());
-        }
-
-        if (!it->GetC() && it->GetO())
-        {
-            QueueCommand(-1, std::format("/sendkey {} up", it->GetControl()));
-            it->SetO(false);
-        }
-    }
-}
-
+#ifndef CONTROL_HELPERS_H_INCLUDED
+#define CONTROL_HELPERS_H_INCLUDED
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include "Stockpile.h"
+#include "Zones.h"
+
+void Stockpile::ControlsReload()
+{
+    QueueCommand(-1, "/releasekeys");
+
+    for (std::list<Control>::iterator it = controls.begin(); it != controls.end(); ++it)
+    {
+        it->SetC(false);
+        it->SetO(false);
+    }
+}
+
+void Stockpile::ControlsReset()
+{
+    for (std::list<Control>::iterator it = controls.begin(); it != controls.end(); ++it)
+    {
+        it->SetC(false);
+    }
+}
+
+void Stockpile::ControlsDown(uint8_t keys)
+{
+    uint8_t key = 0x01;
+
+    for (std::list<Control>::iterator it = controls.begin(); it != controls.end(); ++it, key <<= 1)
+    {
+        if (keys & key)
+        {
+            it->SetC(true);
+        }
+    }
+}
+
+void Stockpile::Controls()
+{
+    uint8_t key = 0x01;
+
+    for (std::list<Control>::iterator it = controls.begin(); it != controls.end(); ++it, key <<= 1)
+    {
+        if (it->GetC() && !it->GetO())
+        {
+            QueueCommand(-1, tick_arena.Format("/sendkey {} down", it->GetControl()));
+            it->SetO(it->GetC());
+
+            // TRACE UNTIL THE TURN OR MOVE SHOWS UP
+            const Reaction reaction = key & (KeyLeft | KeyRight) ? Reaction::Turn : Reaction::Move;
+
+            metrics.Reactions().Emit(reaction, tick_ms, -1, entity->GetLocalPositionX(player_id), entity->GetLocalPositionY(player_id), entity->GetHeading(player_id));
+        }
+
+        if (!it->GetC() && it->GetO())
+        {
+            QueueCommand(-1, tick_arena.Format("/sendkey {} up", it->GetControl()));
+            it->SetO(false);
+        }
+    }
+}
+
 #endif // CONTROL_HELPERS_H_INCLUDED
\ No newline at end of file
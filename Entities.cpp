@@ -0,0 +1,119 @@
+#ifndef ENTITIES_H_INCLUDED
+#define ENTITIES_H_INCLUDED
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include "Stockpile.h"
+#include "Zones.h"
+
+/**
+ * Snapshots every entity slot and diffs it against the previous frame.
+ *
+ * Only mobs (SpawnFlags 0x10) carry position, HP, status and claim, everything else is tracked for presence and
+ * slot reuse only. Static mobs take their flags from the mob table, anything else is classified by name once per
+ * spawn (or when the matcher changes), and the target candidates are only re-evaluated for slots that changed.
+ */
+void Stockpile::UpdateEntities()
+{
+    player_server_id = entity->GetServerId(player_id);
+
+    for (uint32_t index = 0; index < EntityTracker::Count; index++)
+    {
+        EntityTracker::Entry& e = entities.Next(index);
+        e = {};
+
+        if (entity->GetActorPointer(index) == 0)
+        {
+            continue;
+        }
+
+        // entity.SpawnFlags[0x01 = PC, 0x02 = NPC, 0x10 = Mob, 0x0D = Self]
+        // entity.EntityType[0 = PC, 1 = NPC, 2 = NPC(Fixed Models), 3 = Doors etc.]
+
+        e.present = true;
+        e.server_id = entity->GetServerId(index);
+        e.spawn_flags = uint8_t(entity->GetSpawnFlags(index));
+
+        if (e.spawn_flags != 0x10)
+        {
+            continue;
+        }
+
+        e.x = entity->GetLocalPositionX(index);
+        e.y = entity->GetLocalPositionY(index);
+        e.z = entity->GetLocalPositionZ(index);
+        e.hp = uint8_t(entity->GetHPPercent(index));
+        e.status = uint8_t(entity->GetStatusServer(index));
+        e.claim_id = entity->GetClaimStatus(index);
+    }
+
+    entities.Diff();
+
+    // MATCHER CHANGED, EVERY PRESENT MOB IS RECLASSIFIED
+    if (mobs_reclassify)
+    {
+        for (uint32_t index = 0; index < EntityTracker::Count; index++)
+        {
+            const EntityTracker::Entry& e = entities.Get(index);
+
+            mobs_class[index] = e.present && e.spawn_flags == 0x10 ? ClassifyMob(index) : Matcher::None;
+            UpdateCandidate(index);
+        }
+
+        mobs_reclassify = false;
+        return;
+    }
+
+    entities.ForEachDirty([this](uint32_t index, uint8_t changes)
+    {
+        if (changes & EntityTracker::Spawned)
+        {
+            mobs_class[index] = entities.Get(index).spawn_flags == 0x10 ? ClassifyMob(index) : Matcher::None;
+        }
+
+        if (changes & EntityTracker::Despawned)
+        {
+            mobs_class[index] = Matcher::None;
+        }
+
+        UpdateCandidate(index);
+    });
+}
+
+/**
+ * Re-evaluates whether a slot is a target candidate, and whether it is attacking the player. Mobs the chat said
+ * cannot be reached are neither, until they expire. (ApplyChatEvents re-evaluates them when they do.)
+ *
+ * A mob is aggro while it is claimed by the player. A mob a packet showed attacking the player stays aggro while it
+ * is unclaimed, until someone else claims it, it dies or its slot is reused.
+ */
+void Stockpile::UpdateCandidate(uint32_t index)
+{
+    const EntityTracker::Entry& e = entities.Get(index);
+
+    bool unreachable = IsUnreachable(index);
+
+    entities.Mark(index, e.present && e.spawn_flags == 0x10 && e.hp > 0 && (mobs_class[index] & Matcher::Selected) && !unreachable);
+
+    bool alive = e.present && e.spawn_flags == 0x10 && e.hp > 0 && e.status != 2 && e.status != 3 && !unreachable;
+    bool attacking = entities.IsAggro(index) && e.claim_id == 0 && !(entities.Changes(index) & EntityTracker::Spawned);
+
+    entities.SetAggro(index, alive && (e.claim_id == player_server_id || attacking));
+}
+
+/**
+ * Static zone mobs are looked up in the mob table, only dynamic spawns are classified by name.
+ */
+uint8_t Stockpile::ClassifyMob(uint32_t index)
+{
+    if (zone_context->mob_table.Contains(index))
+    {
+        return zone_context->mob_table.Flags(index);
+    }
+
+    return mobs_matcher.Classify(entity->GetName(index));
+}
+
+#endif // ENTITIES_H_INCLUDED
@@ -0,0 +1,317 @@
+#ifndef ENTITY_TRACKER_H_INCLUDED
+#define ENTITY_TRACKER_H_INCLUDED
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <utility>
+
+/**
+ * EntityTracker Class Implementation
+ *
+ * Keeps the last entity snapshot and diffs each new one against it, producing a dirty bitmap of the slots that
+ * changed and what changed about them. Consumers only walk the dirty bits instead of re-evaluating all 2304 slots.
+ *
+ * Every slot also carries a generation that is bumped whenever the slot is (re)spawned, including when a dynamic
+ * slot (1792 - 2303) is reused by a different server id. A Handle remembers the generation it was taken at, so a
+ * target that despawned and had its slot reused is detected as stale instead of silently becoming a new mob.
+ *
+ * Usage per frame: Write each slot through Next, then call Diff.
+ *
+ * Version changes whenever the current frame does, so a copy of it only needs refreshing when the version differs.
+ */
+class EntityTracker final
+{
+public:
+    static constexpr uint32_t Count = 2304;
+
+    enum : uint8_t
+    {
+        Moved = 0x01,
+        HP = 0x02,
+        Claim = 0x04,
+        Spawned = 0x08,
+        Despawned = 0x10,
+        Status = 0x20,
+    };
+
+    struct Entry
+    {
+        float x;
+        float y;
+        float z;
+        uint32_t server_id;
+        uint32_t claim_id;
+        uint8_t hp;
+        uint8_t status;
+        uint8_t spawn_flags;
+        bool present;
+    };
+
+    struct Handle
+    {
+        int32_t index = -1;
+        uint32_t generation = 0;
+    };
+
+    /**
+     * The diffed state of every slot. Copied whole into the worker snapshot, so the worker reads the same frame
+     * the render thread diffed without touching the tracker itself.
+     */
+    struct Frame
+    {
+        std::array<Entry, Count> entries{};
+        std::array<uint32_t, Count> generations{};
+        std::array<uint8_t, Count> changes{};
+        std::array<uint64_t, Count / 64> marked{};  // Owned by the consumer. (ie. target candidates)
+        std::array<uint64_t, Count / 64> aggro{};   // Owned by the consumer. (ie. mobs attacking the player)
+
+        const Entry& Get(uint32_t index) const
+        {
+            return entries[index];
+        }
+
+        uint8_t Changes(uint32_t index) const
+        {
+            return changes[index];
+        }
+
+        /**
+         * Invokes f(index) for every marked slot.
+         */
+        template <typename F>
+        void ForEachMarked(F&& f) const
+        {
+            for (uint32_t word = 0; word < Count / 64; word++)
+            {
+                for (uint64_t bits = marked[word]; bits != 0; bits &= bits - 1)
+                {
+                    f(word * 64 + uint32_t(std::countr_zero(bits)));
+                }
+            }
+        }
+
+        bool IsAggro(uint32_t index) const
+        {
+            return (aggro[index / 64] >> (index % 64)) & 1;
+        }
+
+        /**
+         * Invokes f(index) for every aggro slot.
+         */
+        template <typename F>
+        void ForEachAggro(F&& f) const
+        {
+            for (uint32_t word = 0; word < Count / 64; word++)
+            {
+                for (uint64_t bits = aggro[word]; bits != 0; bits &= bits - 1)
+                {
+                    f(word * 64 + uint32_t(std::countr_zero(bits)));
+                }
+            }
+        }
+
+        Handle MakeHandle(int32_t index) const
+        {
+            if (index < 0 || index >= int32_t(Count))
+            {
+                return Handle{};
+            }
+
+            return Handle{ index, generations[index] };
+        }
+
+        /**
+         * Returns true if the slot the handle points at despawned or was reused since the handle was taken.
+         */
+        bool IsStale(const Handle& handle) const
+        {
+            return handle.index < 0 || handle.index >= int32_t(Count) || !entries[handle.index].present || generations[handle.index] != handle.generation;
+        }
+    };
+
+private:
+    Frame current{};
+    std::array<Entry, Count> next{};
+    std::array<uint64_t, Count / 64> dirty{};
+    uint32_t dirty_count = 0;           // Dirty slots of the last Diff, its changes are cleared by the next one.
+    uint32_t version = 1;
+
+public:
+    EntityTracker(void) {}
+    ~EntityTracker(void) {}
+
+    Entry& Next(uint32_t index)
+    {
+        return next[index];
+    }
+
+    const Entry& Get(uint32_t index) const
+    {
+        return current.Get(index);
+    }
+
+    uint8_t Changes(uint32_t index) const
+    {
+        return current.Changes(index);
+    }
+
+    const Frame& Current() const
+    {
+        return current;
+    }
+
+    uint32_t Version() const
+    {
+        return version;
+    }
+
+    /**
+     * Diffs the written snapshot against the current one and makes it current.
+     *
+     * @return {uint32_t} The number of dirty slots.
+     */
+    uint32_t Diff()
+    {
+        uint32_t count = 0;
+
+        dirty.fill(0);
+
+        for (uint32_t index = 0; index < Count; index++)
+        {
+            const Entry& a = current.entries[index];
+            const Entry& b = next[index];
+
+            uint8_t change = 0;
+
+            if (b.present && (!a.present || a.server_id != b.server_id))
+            {
+                change |= Spawned;
+                current.generations[index]++;
+            }
+            else if (!b.present && a.present)
+            {
+                change |= Despawned;
+            }
+            else if (b.present)
+            {
+                if (a.x != b.x || a.y != b.y || a.z != b.z)
+                {
+                    change |= Moved;
+                }
+
+                if (a.hp != b.hp)
+                {
+                    change |= HP;
+                }
+
+                if (a.claim_id != b.claim_id)
+                {
+                    change |= Claim;
+                }
+
+                if (a.status != b.status)
+                {
+                    change |= Status;
+                }
+            }
+
+            current.changes[index] = change;
+
+            if (change != 0)
+            {
+                dirty[index / 64] |= uint64_t(1) << (index % 64);
+                count++;
+            }
+
+            current.entries[index] = b;
+        }
+
+        if (count != 0 || dirty_count != 0)
+        {
+            version++;
+        }
+
+        dirty_count = count;
+
+        return count;
+    }
+
+    /**
+     * Invokes f(index, changes) for every dirty slot of the last Diff.
+     */
+    template <typename F>
+    void ForEachDirty(F&& f) const
+    {
+        for (uint32_t word = 0; word < Count / 64; word++)
+        {
+            for (uint64_t bits = dirty[word]; bits != 0; bits &= bits - 1)
+            {
+                const uint32_t index = word * 64 + uint32_t(std::countr_zero(bits));
+                f(index, current.changes[index]);
+            }
+        }
+    }
+
+    void Mark(uint32_t index, bool mark)
+    {
+        Set(current.marked, index, mark);
+    }
+
+    template <typename F>
+    void ForEachMarked(F&& f) const
+    {
+        current.ForEachMarked(std::forward<F>(f));
+    }
+
+    void SetAggro(uint32_t index, bool aggro)
+    {
+        Set(current.aggro, index, aggro);
+    }
+
+    bool IsAggro(uint32_t index) const
+    {
+        return current.IsAggro(index);
+    }
+
+    Handle MakeHandle(int32_t index) const
+    {
+        return current.MakeHandle(index);
+    }
+
+    bool IsStale(const Handle& handle) const
+    {
+        return current.IsStale(handle);
+    }
+
+    void Clear()
+    {
+        current.entries = {};
+        current.changes = {};
+        current.marked = {};
+        current.aggro = {};
+        next = {};
+        dirty = {};
+        dirty_count = 0;
+        version++;
+    }
+
+private:
+    void Set(std::array<uint64_t, Count / 64>& bits, uint32_t index, bool set)
+    {
+        const uint64_t bit = uint64_t(1) << (index % 64);
+        const uint64_t word = set ? bits[index / 64] | bit : bits[index / 64] & ~bit;
+
+        if (word != bits[index / 64])
+        {
+            bits[index / 64] = word;
+            version++;
+        }
+    }
+};
+
+#endif // ENTITY_TRACKER_H_INCLUDED
@@ -1,81 +1,122 @@
-#ifndef HELPERS_H_INCLUDED
-#define HELPERS_H_INCLUDED
-
-#if defined(_MSC_VER) && (_MSC_VER >= 1020)
-#pragma once
-#endif
-
-#include "Stockpile.h"
-#include "Zones.h"
-
-void Stockpile::Log(const std::string& str)
-{
-    if (debug)
-    {
-        m_AshitaCore->GetChatManager()->Write(0, true, str.c_str());
-    }
-}
-
-void Stockpile::QueueCommand(int32_t mode, const std::string& str) 
-{
-    m_AshitaCore->GetChatManager()->QueueCommand(mode, str.c_str());
-    m_AshitaCore->GetChatManager()->Write(0, true, str.c_str());
-}
-
-int Stockpile::RandomFV(int factor, int var) {
-    int min = factor - var;
-    int max = factor + var;
-    return rand() % ((max - min) + 1) + min;
-}
-
-int Stockpile::RandomA(int factor) {
-    int min = factor - (int)(factor * 0.2F);
-    int max = factor + (int)(factor * 0.2F);
-    return Random(min, max);
-}
-
-int Stockpile::Random(int min, int max) {
-    return rand() % ((max - min) + 1) + min;
-}
-
-void Stockpile::ltrim(std::string& s) {
-    s.erase(s.begin(), std::find_if(s.begin(), s.end(), [](unsigned char ch) {
-        return !std::isspace(ch);
-        }));
-}
-
-void Stockpile::rtrim(std::string& s) {
-    s.erase(std::find_if(s.rbegin(), s.rend(), [](unsigned char ch) {
-        return !std::isspace(ch);
-        }).base(), s.end());
-}
-
-void Stockpile::trim(std::string& s) {
-    ltrim(s);
-    rtrim(s);
-}
-
-bool Stockpile::contains_find(std::vector<std::string> vec, std::string search)
-{
-    return std::find(vec.begin(), vec.end(), search) != vec.end();
-}
-
-bool Stockpile::contains_search(std::vector<std::string> vec, std::string search)
-{
-    for (std::string v : vec)
-    {
-        if (search.find(v) != std::string::npos)
-        {
-            return true;
-        }
-    }
-
-    return false;
-}
-
-float Stockpile::distance(Pos p1, Pos p2)
-{
-    return float(sqrt(pow(p2.x - p1.x, 2) + pow(p2.y - p1.y, 2) + pow(p2.z - p1.z, 2) * 1.0));
-}
-
+#ifndef HELPERS_H_INCLUDED
+#define HELPERS_H_INCLUDED
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include "Stockpile.h"
+#include "Zones.h"
+
+void Stockpile::Log(const std::string& str)
+{
+    if (debug)
+    {
+        m_AshitaCore->GetChatManager()->Write(0, true, str.c_str());
+    }
+}
+
+void Stockpile::Log(const char* str)
+{
+    if (debug)
+    {
+        m_AshitaCore->GetChatManager()->Write(0, true, str);
+    }
+}
+
+void Stockpile::QueueCommand(int32_t mode, const char* str) 
+{
+    m_AshitaCore->GetChatManager()->QueueCommand(mode, str);
+    m_AshitaCore->GetChatManager()->Write(0, true, str);
+
+    metrics.Sent(1);
+}
+
+int Stockpile::RandomFV(int factor, int var) {
+    int min = factor - var;
+    int max = factor + var;
+    return rand() % ((max - min) + 1) + min;
+}
+
+int Stockpile::RandomA(int factor) {
+    int min = factor - (int)(factor * 0.2F);
+    int max = factor + (int)(factor * 0.2F);
+    return Random(min, max);
+}
+
+int Stockpile::Random(int min, int max) {
+    return rand() % ((max - min) + 1) + min;
+}
+
+void Stockpile::ltrim(std::string& s) {
+    s.erase(s.begin(), std::find_if(s.begin(), s.end(), [](unsigned char ch) {
+        return !std::isspace(ch);
+        }));
+}
+
+void Stockpile::rtrim(std::string& s) {
+    s.erase(std::find_if(s.rbegin(), s.rend(), [](unsigned char ch) {
+        return !std::isspace(ch);
+        }).base(), s.end());
+}
+
+void Stockpile::trim(std::string& s) {
+    ltrim(s);
+    rtrim(s);
+}
+
+bool Stockpile::contains_find(const std::vector<std::string>& vec, std::string_view search)
+{
+    return std::find(vec.begin(), vec.end(), search) != vec.end();
+}
+
+float Stockpile::distance(Pos p1, Pos p2)
+{
+    return float(sqrt(pow(p2.x - p1.x, 2) + pow(p2.y - p1.y, 2) + pow(p2.z - p1.z, 2) * 1.0));
+}
+
+uint64_t Stockpile::Milliseconds()
+{
+    return uint64_t(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+uint64_t Stockpile::Microseconds()
+{
+    return uint64_t(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+/**
+ * Clips a list box to the rows that are currently visible.
+ *
+ * Must be called inside a list box before any rows are submitted. Only rows in [first, last) should be submitted,
+ * followed by ListClipEnd. Rows outside of the range are replaced by spacers of the same height so the scrollbar
+ * stays correct.
+ */
+void Stockpile::ListClipBegin(int count, int& first, int& last)
+{
+    const auto& imgui = m_AshitaCore->GetGuiManager();
+
+    float height = imgui->GetTextLineHeightWithSpacing();
+
+    first = std::clamp(int(imgui->GetScrollY() / height), 0, count);
+    last = std::clamp(first + int(imgui->GetWindowHeight() / height) + 2, first, count);
+
+    if (first > 0)
+    {
+        imgui->Dummy(ImVec2(1.0f, first * height - imgui->GetStyle().ItemSpacing.y));
+    }
+}
+
+void Stockpile::ListClipEnd(int count, int last)
+{
+    const auto& imgui = m_AshitaCore->GetGuiManager();
+
+    float height = imgui->GetTextLineHeightWithSpacing();
+
+    if (last < count)
+    {
+        imgui->Dummy(ImVec2(1.0f, (count - last) * height - imgui->GetStyle().ItemSpacing.y));
+    }
+}
+
 #endif // HELPERS_H_INCLUDED
\ No newline at end of file
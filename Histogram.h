@@ -0,0 +1,108 @@
+#ifndef HISTOGRAM_H_INCLUDED
+#define HISTOGRAM_H_INCLUDED
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+
+/**
+ * Histogram Class Implementation
+ *
+ * Fixed size log2 histogram of durations, in whatever unit they are added in. Bucket 0 holds 0 and 1, bucket n
+ * holds [2^n, 2^(n+1)) and the last bucket holds everything longer. Adding a sample is a bit scan and an increment,
+ * so a whole session can be recorded without allocating.
+ */
+class Histogram final
+{
+public:
+    static constexpr uint32_t Buckets = 20;     // The last bucket starts at 2^19. (~8.7 minutes in ms)
+
+private:
+    std::array<uint32_t, Buckets> buckets{};
+    uint32_t count;
+    uint64_t sum;
+    uint64_t max;
+
+public:
+    Histogram(void)
+        : count(0)
+        , sum(0)
+        , max(0)
+    {}
+    ~Histogram(void) {}
+
+    void Add(uint64_t ms)
+    {
+        buckets[Bucket(ms)]++;
+        count++;
+        sum += ms;
+        max = std::max(max, ms);
+    }
+
+    void Clear()
+    {
+        buckets.fill(0);
+        count = 0;
+        sum = 0;
+        max = 0;
+    }
+
+    uint32_t Count() const { return count; }
+    uint64_t Sum() const { return sum; }
+    uint64_t Max() const { return max; }
+    uint32_t At(uint32_t bucket) const { return buckets[bucket]; }
+
+    uint64_t Mean() const
+    {
+        return count != 0 ? sum / count : 0;
+    }
+
+    /**
+     * @param {float} fraction - 0.5 for the median, 0.9 for the 90th percentile.
+     * @return {uint64_t} The upper bound of the bucket the percentile falls in, capped at the largest sample.
+     */
+    uint64_t Percentile(float fraction) const
+    {
+        if (count == 0)
+        {
+            return 0;
+        }
+
+        const uint32_t rank = std::max(1u, uint32_t(fraction * float(count) + 0.5f));
+        uint32_t seen = 0;
+
+        for (uint32_t n = 0; n < Buckets; n++)
+        {
+            seen += buckets[n];
+
+            if (seen >= rank)
+            {
+                return std::min(Upper(n), max);
+            }
+        }
+
+        return max;
+    }
+
+    static uint32_t Bucket(uint64_t ms)
+    {
+        const uint32_t width = uint32_t(std::bit_width(ms));
+
+        return std::min(width != 0 ? width - 1 : 0, Buckets - 1);
+    }
+
+    /**
+     * @return {uint64_t} The first duration past the bucket. (The last bucket has none.)
+     */
+    static uint64_t Upper(uint32_t bucket)
+    {
+        return bucket + 1 < Buckets ? uint64_t(1) << (bucket + 1) : UINT64_MAX;
+    }
+};
+
+#endif // HISTOGRAM_H_INCLUDED
@@ -0,0 +1,99 @@
+#ifndef LABEL_H_INCLUDED
+#define LABEL_H_INCLUDED
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <cmath>
+#include <cstring>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+/**
+ * Label Class Implementation
+ *
+ * Retained GUI text. The label is only reformatted when the values it displays change, so a status line that
+ * does not change costs a compare per frame instead of a sprintf_s.
+ *
+ * Floats are compared at the precision they are displayed with (two decimals), bools are shown as True / False
+ * and strings are compared by content. A string is only cached on its own, a line of several values holds numbers.
+ */
+template <typename... T>
+class Label final
+{
+    static_assert(sizeof...(T) == 1 || !(std::is_same_v<T, const char*> || ...), "Only a single value label can show a string.");
+
+    const char* format;
+    std::tuple<T...> value{};
+    bool valid;
+    char text[128]{};
+    char cache[64]{};
+
+public:
+    Label(const char* _format)
+        : format(_format)
+        , valid(false)
+    {}
+    ~Label(void) {}
+
+    const char* Get(const T... _value)
+    {
+        if (valid && Same(std::index_sequence_for<T...>{}, _value...))
+        {
+            return this->text;
+        }
+
+        this->value = { _value... };
+        this->valid = true;
+
+        if constexpr ((std::is_same_v<T, const char*> && ...))
+        {
+            ::strncpy_s(this->cache, _value..., _TRUNCATE);
+        }
+
+        ::sprintf_s(this->text, this->format, Show(_value)...);
+
+        return this->text;
+    }
+
+private:
+    template <size_t... I>
+    bool Same(std::index_sequence<I...>, const T... _value) const
+    {
+        return (Equal(std::get<I>(this->value), _value) && ...);
+    }
+
+    template <typename U>
+    bool Equal(const U last, const U _value) const
+    {
+        if constexpr (std::is_same_v<U, float>)
+        {
+            return std::lround(last * 100.0f) == std::lround(_value * 100.0f);
+        }
+        else if constexpr (std::is_same_v<U, const char*>)
+        {
+            return ::strncmp(this->cache, _value, sizeof(this->cache) - 1) == 0;
+        }
+        else
+        {
+            return last == _value;
+        }
+    }
+
+    template <typename U>
+    static auto Show(const U _value)
+    {
+        if constexpr (std::is_same_v<U, bool>)
+        {
+            return _value ? "True" : "False";
+        }
+        else
+        {
+            return _value;
+        }
+    }
+};
+
+#endif // LABEL_H_INCLUDED
@@ -0,0 +1,337 @@
+#ifndef MATCHER_H_INCLUDED
+#define MATCHER_H_INCLUDED
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * Matcher Class Implementation
+ *
+ * Selection patterns and ban patterns compiled into a single Aho-Corasick automaton, so a name is classified in one
+ * linear pass no matter how many patterns there are.
+ *
+ * Selection patterns:
+ *
+ *      Goblin Thug         exact
+ *      Goblin*             prefix
+ *      *Thug               suffix
+ *      *Goblin*            substring
+ *      Goblin*Thug         wildcard, '*' matches any run of characters
+ *
+ * Ban patterns are plain substrings, the same as mobs_potential_bans has always been.
+ *
+ * Names are scanned as STX + name + ETX, and anchored pattern ends carry the same markers, so prefix, suffix and
+ * exact patterns are ordinary keywords to the automaton. Patterns with several '*' separated segments are matched
+ * by advancing through their segments in order as the keywords are reported.
+ */
+class Matcher final
+{
+public:
+    enum : uint8_t
+    {
+        None = 0x00,
+        Selected = 0x01,
+        Banned = 0x02,
+    };
+
+    static constexpr size_t MaxWildcards = 64;  // Patterns with more than one segment.
+
+private:
+    static constexpr char Begin = '\x02';
+    static constexpr char End = '\x03';
+
+    struct Pattern
+    {
+        uint8_t flags;
+        uint16_t segments;
+        uint16_t wildcard;              // Index into the per scan progress, only used if segments > 1.
+    };
+
+    struct Occurrence
+    {
+        uint16_t pattern;
+        uint16_t segment;
+        uint16_t length;
+    };
+
+    struct Node
+    {
+        int32_t keyword = -1;           // Keyword ending at this node.
+        int32_t output = -1;            // Next node on the suffix chain with a keyword.
+    };
+
+    std::array<uint8_t, 256> classes{}; // Byte to alphabet class. (0 = not in any pattern.)
+    int32_t alphabet = 1;
+
+    std::vector<int32_t> delta;         // Full transition table, nodes * alphabet.
+    std::vector<Node> nodes;
+    std::vector<Pattern> patterns;
+    std::vector<std::vector<Occurrence>> keywords;
+
+    uint8_t always = None;              // Flags of patterns that match everything. ("*")
+    size_t wildcards = 0;
+
+public:
+    Matcher(void) {}
+    ~Matcher(void) {}
+
+    /**
+     * Compiles the selection and ban patterns. Should only be called when either list changes.
+     *
+     * @return {bool} False if a wildcard pattern had to be skipped because MaxWildcards was reached.
+     */
+    bool Compile(const std::vector<std::string>& selected, const std::vector<std::string>& bans)
+    {
+        classes.fill(0);
+        alphabet = 1;
+        delta.clear();
+        nodes.clear();
+        patterns.clear();
+        keywords.clear();
+        always = None;
+        wildcards = 0;
+
+        std::vector<std::string> words;
+        bool complete = true;
+
+        const auto add = [&](std::string_view text, uint8_t flags, bool substring)
+        {
+            std::vector<std::string> segments;
+
+            if (substring)
+            {
+                if (!text.empty())
+                {
+                    segments.emplace_back(text);
+                }
+            }
+            else
+            {
+                size_t start = 0;
+
+                while (start <= text.size())
+                {
+                    size_t star = text.find('*', start);
+                    std::string_view part = text.substr(start, star == std::string_view::npos ? std::string_view::npos : star - start);
+
+                    std::string segment(part);
+
+                    if (start == 0)
+                    {
+                        segment.insert(segment.begin(), Begin);
+                    }
+
+                    if (star == std::string_view::npos)
+                    {
+                        segment.push_back(End);
+                    }
+
+                    // EMPTY PARTS ARE DROPPED, A LONE MARKER MEANS THAT END IS A '*'
+                    if (!part.empty() || segment.size() == 2)
+                    {
+                        segments.push_back(segment);
+                    }
+
+                    if (star == std::string_view::npos)
+                    {
+                        break;
+                    }
+
+                    start = star + 1;
+                }
+            }
+
+            if (segments.empty())
+            {
+                always |= flags;
+                return;
+            }
+
+            if (segments.size() > 1 && wildcards == MaxWildcards)
+            {
+                complete = false;
+                return;
+            }
+
+            Pattern pattern{ flags, uint16_t(segments.size()), uint16_t(segments.size() > 1 ? wildcards++ : 0) };
+
+            for (uint16_t n = 0; n < uint16_t(segments.size()); n++)
+            {
+                size_t id = std::find(words.begin(), words.end(), segments[n]) - words.begin();
+
+                if (id == words.size())
+                {
+                    words.push_back(segments[n]);
+                    keywords.emplace_back();
+                }
+
+                keywords[id].push_back({ uint16_t(patterns.size()), n, uint16_t(segments[n].size()) });
+            }
+
+            patterns.push_back(pattern);
+        };
+
+        for (const std::string& s : selected)
+        {
+            add(s, Selected, false);
+        }
+
+        for (const std::string& s : bans)
+        {
+            add(s, Banned, true);
+        }
+
+        // ALPHABET
+        for (const std::string& word : words)
+        {
+            for (const char c : word)
+            {
+                if (classes[uint8_t(c)] == 0)
+                {
+                    classes[uint8_t(c)] = uint8_t(alphabet++);
+                }
+            }
+        }
+
+        // TRIE
+        nodes.emplace_back();
+        delta.assign(alphabet, -1);
+
+        for (int32_t id = 0; id < int32_t(words.size()); id++)
+        {
+            int32_t state = 0;
+
+            for (const char c : words[id])
+            {
+                int32_t& next = delta[state * alphabet + classes[uint8_t(c)]];
+
+                if (next == -1)
+                {
+                    next = int32_t(nodes.size());
+                    nodes.emplace_back();
+                    delta.resize(delta.size() + alphabet, -1);
+                }
+
+                state = delta[state * alphabet + classes[uint8_t(c)]];
+            }
+
+            nodes[state].keyword = id;
+        }
+
+        // FAILURE LINKS (BFS), FOLDED INTO A FULL TRANSITION TABLE
+        std::vector<int32_t> fail(nodes.size(), 0);
+        std::vector<int32_t> queue;
+        queue.reserve(nodes.size());
+
+        for (int32_t a = 0; a < alphabet; a++)
+        {
+            int32_t& next = delta[a];
+
+            if (next == -1)
+            {
+                next = 0;
+            }
+            else
+            {
+                fail[next] = 0;
+                queue.push_back(next);
+            }
+        }
+
+        for (size_t head = 0; head < queue.size(); head++)
+        {
+            const int32_t state = queue[head];
+            const int32_t f = fail[state];
+
+            nodes[state].output = nodes[f].keyword != -1 ? f : nodes[f].output;
+
+            for (int32_t a = 0; a < alphabet; a++)
+            {
+                int32_t& next = delta[state * alphabet + a];
+
+                if (next == -1)
+                {
+                    next = delta[f * alphabet + a];
+                }
+                else
+                {
+                    fail[next] = delta[f * alphabet + a];
+                    queue.push_back(next);
+                }
+            }
+        }
+
+        return complete;
+    }
+
+    /**
+     * Classifies a name in a single pass.
+     *
+     * @return {uint8_t} Selected and / or Banned flags.
+     */
+    uint8_t Classify(std::string_view name) const
+    {
+        uint8_t flags = always;
+
+        if (nodes.empty())
+        {
+            return flags;
+        }
+
+        // WILDCARD PROGRESS (NEXT SEGMENT, END OF LAST SEGMENT)
+        std::array<uint16_t, MaxWildcards> next{};
+        std::array<uint16_t, MaxWildcards> last{};
+
+        int32_t state = 0;
+        uint16_t position = 0;
+
+        const auto step = [&](char c)
+        {
+            state = delta[state * alphabet + classes[uint8_t(c)]];
+            position++;
+
+            for (int32_t node = nodes[state].keyword != -1 ? state : nodes[state].output; node > 0; node = nodes[node].output)
+            {
+                for (const Occurrence& o : keywords[nodes[node].keyword])
+                {
+                    const Pattern& p = patterns[o.pattern];
+
+                    if (p.segments == 1)
+                    {
+                        flags |= p.flags;
+                    }
+                    else if (next[p.wildcard] == o.segment && position - o.length >= last[p.wildcard])
+                    {
+                        last[p.wildcard] = position;
+
+                        if (++next[p.wildcard] == p.segments)
+                        {
+                            flags |= p.flags;
+                        }
+                    }
+                }
+            }
+        };
+
+        step(Begin);
+
+        for (const char c : name)
+        {
+            step(c);
+        }
+
+        step(End);
+
+        return flags;
+    }
+};
+
+#endif // MATCHER_H_INCLUDED
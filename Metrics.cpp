@@ -0,0 +1,160 @@
+#ifndef METRICS_HELPERS_H_INCLUDED
+#define METRICS_HELPERS_H_INCLUDED
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include "Stockpile.h"
+#include "Zones.h"
+
+/**
+ * Turns this frame's state into session KPIs. (Render thread, after the decisions are applied.)
+ *
+ * A change of closest target ends the previous one: it counts as a kill if it was engaged and is now dead (or a
+ * packet showed it dead), otherwise as a retarget.
+ */
+void Stockpile::UpdateMetrics()
+{
+    if (!running)
+    {
+        metrics.Pause();
+        metrics_target_id = -1;
+        metrics_engaged = false;
+        return;
+    }
+
+    const int current = decided.closest_target_id;
+
+    if (current != metrics_target_id)
+    {
+        if (metrics_target_id != -1)
+        {
+            const EntityTracker::Entry& e = entities.Current().Get(metrics_target_id);
+
+            bool dead = e.hp == 0 || e.status == 2 || e.status == 3 || invalidated_handle.index == metrics_target_id;
+
+            if (dead && metrics_engaged)
+            {
+                metrics.Killed(metrics_target_name, tick_ms);
+            }
+            else
+            {
+                metrics.Abandoned();
+            }
+        }
+
+        if (current != -1)
+        {
+            metrics.Acquired(tick_ms);
+            ::strncpy_s(metrics_target_name, entity->GetName(current), _TRUNCATE);
+        }
+
+        metrics_target_id = current;
+        metrics_engaged = false;
+    }
+
+    if (current != -1 && has_lock && !metrics_engaged)
+    {
+        metrics.Engaged(tick_ms);
+        metrics_engaged = true;
+    }
+
+    // DECISIONS ARE NOT APPLIED WHILE DEAD, SO THE LAST ONE APPLIED IS STILL FROM BEFORE
+    metrics.Frame(is_player_dead ? BotState::Recover : decided.state, tick_ms);
+}
+
+/**
+ * Closes every traced action whose effect shows in this frame. (Render thread, after the entities are updated.)
+ */
+void Stockpile::TraceReactions()
+{
+    ReactionTracer& reactions = metrics.Reactions();
+
+    const float x = entity->GetLocalPositionX(player_id);
+    const float y = entity->GetLocalPositionY(player_id);
+    const float heading = entity->GetHeading(player_id);
+
+    reactions.Observe(Reaction::Select, tick_ms, [&](const ReactionTracer::Pending& p) { return has_target && targeted_id == p.target; });
+    reactions.Observe(Reaction::EngagePacket, tick_ms, [&](const ReactionTracer::Pending& p) { return has_lock && targeted_id == p.target; });
+    reactions.Observe(Reaction::EngageCommand, tick_ms, [&](const ReactionTracer::Pending& p) { return has_lock && targeted_id == p.target; });
+    reactions.Observe(Reaction::Turn, tick_ms, [&](const ReactionTracer::Pending& p) { return heading != p.heading; });
+    reactions.Observe(Reaction::Move, tick_ms, [&](const ReactionTracer::Pending& p) { return x != p.x || y != p.y; });
+
+    reactions.Expire(tick_ms);
+}
+
+/**
+ * Formats the histogram lines of the Session panel. (Render thread, from the GUI.)
+ *
+ * The visits, decide cost and reactions grow every frame, formatting them per frame is a dozen sprintf_s calls for
+ * text nobody reads that fast. They are refreshed once a second, and right away when a target is acquired, engaged,
+ * killed or dropped, or the session is cleared.
+ */
+void Stockpile::FormatSummary()
+{
+    if (summary_version == metrics.Version() && tick_ms < summary_ms + SummaryMs)
+    {
+        return;
+    }
+
+    summary_version = metrics.Version();
+    summary_ms = tick_ms;
+
+    for (size_t n = 0; n < Metrics::States; n++)
+    {
+        const BotState state = BotState(n);
+        const Histogram& visits = metrics.Visits(state);
+
+        ::sprintf_s(summary_states[n], "%s: %.1f%% (%u visits, %.1fs mean, %lluus decide p90)", BotStateNames[n], metrics.Share(state) * 100.0f, visits.Count(), visits.Mean() / 1000.0f, metrics.DecideCost(state).Percentile(0.9f));
+    }
+
+    const Histogram& engage = metrics.TimeToEngage();
+    const Histogram& kill = metrics.TimeToKill();
+    const Histogram& down = metrics.KillToEngage();
+
+    ::sprintf_s(summary_times[0], "Time to Engage: %.1fs (p50 %.1fs, p90 %.1fs)", engage.Mean() / 1000.0f, engage.Percentile(0.5f) / 1000.0f, engage.Percentile(0.9f) / 1000.0f);
+    ::sprintf_s(summary_times[1], "Time to Kill: %.1fs (p50 %.1fs, p90 %.1fs)", kill.Mean() / 1000.0f, kill.Percentile(0.5f) / 1000.0f, kill.Percentile(0.9f) / 1000.0f);
+    ::sprintf_s(summary_times[2], "Kill to Engage: %.1fs (p50 %.1fs, p90 %.1fs)", down.Mean() / 1000.0f, down.Percentile(0.5f) / 1000.0f, down.Percentile(0.9f) / 1000.0f);
+
+    for (size_t n = 0; n < size_t(Reaction::Count); n++)
+    {
+        const Reaction reaction = Reaction(n);
+        const Histogram& latency = metrics.Reactions().Latency(reaction);
+
+        ::sprintf_s(summary_reactions[n], "%s: %llums mean, p50 %llums, p90 %llums (%u seen, %u missed)", ReactionNames[n], latency.Mean(), latency.Percentile(0.5f), latency.Percentile(0.9f), latency.Count(), metrics.Reactions().Missed(reaction));
+    }
+
+    summary_mob_count = metrics.MobCount();
+
+    for (uint32_t n = 0; n < summary_mob_count; n++)
+    {
+        const Metrics::Mob& mob = metrics.MobAt(n);
+
+        ::sprintf_s(summary_mobs[n], "%s: %u, %.1fs", mob.name, mob.time_to_kill.Count(), mob.time_to_kill.Mean() / 1000.0f);
+    }
+}
+
+/**
+ * Writes the session to config/stockpile/metrics/session_<time>.csv.
+ */
+void Stockpile::ExportMetrics()
+{
+    const std::filesystem::path directory = std::filesystem::path(m_AshitaCore->GetInstallPath()) / "config" / "stockpile" / "metrics";
+
+    std::error_code error;
+    std::filesystem::create_directories(directory, error);
+
+    const std::filesystem::path file = directory / std::format("session_{}.csv", uint64_t(std::time(nullptr)));
+
+    if (metrics.Export(file.string().c_str()))
+    {
+        Log(std::format("Exported: {}", file.string()));
+    }
+    else
+    {
+        Log(std::format("Export failed: {}", file.string()));
+    }
+}
+
+#endif // METRICS_HELPERS_H_INCLUDED
@@ -0,0 +1,347 @@
+#ifndef METRICS_H_INCLUDED
+#define METRICS_H_INCLUDED
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+
+#include "BotState.h"
+#include "Histogram.h"
+#include "ReactionTracer.h"
+
+/**
+ * Metrics Class Implementation
+ *
+ * Session KPIs, fed from the bot's state transitions on the render thread:
+ *
+ *  - Acquired: a new closest target was picked.
+ *  - Engaged: the player locked on to it. (Time to engage.)
+ *  - Killed: it died while engaged. (Time to kill, per mob name.)
+ *  - Engaged after a kill: the down time until the next lock. (Kill to engage.)
+ *  - Abandoned: it was dropped for another target without dying. (Retarget churn.)
+ *  - Frame: wall time, split by bot state, and how long each visit to a state lasted.
+ *  - Decided: how long the worker's decision took, per state.
+ *  - Sent: chat commands and injected packets sent to the game.
+ *  - Reactions: how long the game took to show the effect of each action, see ReactionTracer.
+ *
+ * Time only accumulates while the bot runs. Everything is fixed size, mob names past Names share the last row.
+ */
+class Metrics final
+{
+public:
+    static constexpr size_t States = size_t(BotState::Count);
+    static constexpr uint32_t Names = 32;
+
+    struct Mob
+    {
+        char name[0x1C];
+        Histogram time_to_kill;
+    };
+
+private:
+    uint64_t last_ms;
+    uint64_t acquired_ms;
+    uint64_t engaged_ms;
+    uint64_t killed_ms;
+    std::array<uint64_t, States> state_ms{};
+    BotState state;
+    uint64_t entered_ms;
+    std::array<Histogram, States> visits{};                     // Milliseconds per visit.
+    std::array<Histogram, States> decide_us{};                  // Microseconds per decision.
+    std::array<std::array<uint32_t, States>, States> transitions{};
+    uint32_t acquired;
+    uint32_t kills;
+    uint32_t retargets;
+    uint32_t commands;
+
+    Histogram time_to_engage;
+    Histogram time_to_kill;
+    Histogram kill_to_engage;
+    std::array<Mob, Names> mobs{};
+    uint32_t mob_count;
+
+    ReactionTracer reactions;
+    uint32_t version;                                           // Bumped by the events, see Version.
+
+public:
+    Metrics(void)
+        : last_ms(0)
+        , acquired_ms(0)
+        , engaged_ms(0)
+        , killed_ms(0)
+        , state(BotState::Idle)
+        , entered_ms(0)
+        , acquired(0)
+        , kills(0)
+        , retargets(0)
+        , commands(0)
+        , mob_count(0)
+        , version(1)
+    {}
+    ~Metrics(void) {}
+
+    /**
+     * Charges the time since the last frame to the frame's state, and closes the visit to the previous state.
+     */
+    void Frame(BotState current, uint64_t now)
+    {
+        if (last_ms != 0 && now > last_ms)
+        {
+            state_ms[size_t(current)] += now - last_ms;
+        }
+
+        if (current != state)
+        {
+            if (entered_ms != 0)
+            {
+                visits[size_t(state)].Add(now - entered_ms);
+                transitions[size_t(state)][size_t(current)]++;
+            }
+
+            state = current;
+            entered_ms = now;
+        }
+
+        last_ms = now;
+    }
+
+    void Decided(BotState current, uint64_t us)
+    {
+        decide_us[size_t(current)].Add(us);
+    }
+
+    /**
+     * The bot stopped, the time until it starts again is not part of the session.
+     */
+    void Pause()
+    {
+        last_ms = 0;
+        engaged_ms = 0;
+        acquired_ms = 0;
+        killed_ms = 0;
+        state = BotState::Idle;
+        entered_ms = 0;
+        reactions.Abandon();
+    }
+
+    void Acquired(uint64_t now)
+    {
+        acquired++;
+        version++;
+        acquired_ms = now;
+        engaged_ms = 0;
+    }
+
+    void Engaged(uint64_t now)
+    {
+        if (acquired_ms != 0)
+        {
+            time_to_engage.Add(now - acquired_ms);
+        }
+
+        // RETARGETS IN BETWEEN ARE PART OF THE DOWN TIME
+        if (killed_ms != 0)
+        {
+            kill_to_engage.Add(now - killed_ms);
+            killed_ms = 0;
+        }
+
+        version++;
+        engaged_ms = now;
+    }
+
+    void Killed(const char* name, uint64_t now)
+    {
+        kills++;
+        version++;
+        killed_ms = now;
+
+        if (engaged_ms == 0)
+        {
+            return;
+        }
+
+        time_to_kill.Add(now - engaged_ms);
+        Find(name).time_to_kill.Add(now - engaged_ms);
+        engaged_ms = 0;
+    }
+
+    void Abandoned()
+    {
+        retargets++;
+        version++;
+        engaged_ms = 0;
+    }
+
+    void Sent(uint32_t count)
+    {
+        commands += count;
+    }
+
+    void Clear()
+    {
+        const uint32_t last = version;
+
+        *this = Metrics();
+        version = last + 1;
+    }
+
+    /**
+     * Changes when a target is acquired, engaged, killed or dropped, or the session is cleared. The histograms that
+     * grow every frame (visits, decide cost, reactions) do not bump it.
+     */
+    uint32_t Version() const { return version; }
+
+    uint64_t Session() const
+    {
+        uint64_t total = 0;
+
+        for (uint64_t ms : state_ms)
+        {
+            total += ms;
+        }
+
+        return total;
+    }
+
+    float Share(BotState current) const { return Session() != 0 ? float(state_ms[size_t(current)]) / float(Session()) : 0.0f; }
+    const Histogram& Visits(BotState current) const { return visits[size_t(current)]; }
+    const Histogram& DecideCost(BotState current) const { return decide_us[size_t(current)]; }
+    uint32_t Transitions(BotState from, BotState to) const { return transitions[size_t(from)][size_t(to)]; }
+    uint32_t Kills() const { return kills; }
+    uint32_t Retargets() const { return retargets; }
+    uint32_t Commands() const { return commands; }
+    float KillsPerHour() const { return PerMs(kills) * 3600000.0f; }
+    float CommandsPerMinute() const { return PerMs(commands) * 60000.0f; }
+    const Histogram& TimeToEngage() const { return time_to_engage; }
+    const Histogram& TimeToKill() const { return time_to_kill; }
+    const Histogram& KillToEngage() const { return kill_to_engage; }
+    uint32_t MobCount() const { return mob_count; }
+    const Mob& MobAt(uint32_t n) const { return mobs[n]; }
+    ReactionTracer& Reactions() { return reactions; }
+    const ReactionTracer& Reactions() const { return reactions; }
+
+    /**
+     * Writes every counter and histogram as one CSV table. Counters fill count or total, histograms fill every column
+     * with one column per bucket, named by the bucket's upper bound. The metric name carries the unit.
+     */
+    bool Export(const char* path) const
+    {
+        std::ofstream file(path, std::ios::trunc);
+
+        if (!file)
+        {
+            return false;
+        }
+
+        file << "metric,name,count,total,mean,p50,p90,max";
+
+        for (uint32_t n = 0; n < Histogram::Buckets; n++)
+        {
+            if (Histogram::Upper(n) != UINT64_MAX)
+            {
+                file << ",lt_" << Histogram::Upper(n);
+            }
+            else
+            {
+                file << ",ge_" << (uint64_t(1) << n);
+            }
+        }
+
+        file << "\n";
+
+        file << "session_ms,,," << Session() << "\n";
+
+        file << "acquired,," << acquired << "\n";
+        file << "kills,," << kills << "\n";
+        file << "retargets,," << retargets << "\n";
+        file << "commands,," << commands << "\n";
+
+        Write(file, "time_to_engage_ms", "", time_to_engage);
+        Write(file, "time_to_kill_ms", "", time_to_kill);
+        Write(file, "kill_to_engage_ms", "", kill_to_engage);
+
+        for (uint32_t n = 0; n < mob_count; n++)
+        {
+            Write(file, "time_to_kill_ms", mobs[n].name, mobs[n].time_to_kill);
+        }
+
+        for (size_t n = 0; n < States; n++)
+        {
+            file << "state_total_ms," << BotStateNames[n] << ",," << state_ms[n] << "\n";
+            Write(file, "state_visit_ms", BotStateNames[n], visits[n]);
+            Write(file, "state_decide_us", BotStateNames[n], decide_us[n]);
+        }
+
+        for (size_t n = 0; n < size_t(Reaction::Count); n++)
+        {
+            Write(file, "reaction_ms", ReactionNames[n], reactions.Latency(Reaction(n)));
+            file << "reaction_missed," << ReactionNames[n] << "," << reactions.Missed(Reaction(n)) << "\n";
+        }
+
+        for (size_t from = 0; from < States; from++)
+        {
+            for (size_t to = 0; to < States; to++)
+            {
+                if (transitions[from][to] != 0)
+                {
+                    file << "transition," << BotStateNames[from] << ">" << BotStateNames[to] << "," << transitions[from][to] << "\n";
+                }
+            }
+        }
+
+        return bool(file);
+    }
+
+private:
+    float PerMs(uint32_t value) const
+    {
+        return Session() != 0 ? float(value) / float(Session()) : 0.0f;
+    }
+
+    Mob& Find(const char* name)
+    {
+        for (uint32_t n = 0; n < mob_count; n++)
+        {
+            if (::strncmp(mobs[n].name, name, sizeof(mobs[n].name)) == 0)
+            {
+                return mobs[n];
+            }
+        }
+
+        // THE LAST ROW TAKES EVERY NAME THAT DID NOT FIT
+        if (mob_count >= Names - 1)
+        {
+            ::strncpy_s(mobs[Names - 1].name, "Other", _TRUNCATE);
+            mob_count = Names;
+
+            return mobs[Names - 1];
+        }
+
+        Mob& mob = mobs[mob_count++];
+        ::strncpy_s(mob.name, name, _TRUNCATE);
+
+        return mob;
+    }
+
+    static void Write(std::ofstream& file, const char* metric, const char* name, const Histogram& histogram)
+    {
+        file << metric << "," << name << "," << histogram.Count() << "," << histogram.Sum() << "," << histogram.Mean() << ","
+             << histogram.Percentile(0.5f) << "," << histogram.Percentile(0.9f) << "," << histogram.Max();
+
+        for (uint32_t n = 0; n < Histogram::Buckets; n++)
+        {
+            file << "," << histogram.At(n);
+        }
+
+        file << "\n";
+    }
+};
+
+#endif // METRICS_H_INCLUDED
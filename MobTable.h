@@ -0,0 +1,213 @@
+#ifndef MOB_TABLE_H_INCLUDED
+#define MOB_TABLE_H_INCLUDED
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <memory_resource>
+#include <string_view>
+#include <vector>
+
+#include "Matcher.h"
+
+/**
+ * MobTable Class Implementation
+ *
+ * The zone's static entities (target index 0 - 1023) straight from the zone mob DAT, indexed by target index.
+ *
+ * The DAT is read into one buffer and indexed in a single pass over its 0x20 byte records (0x1C name, 4 byte server
+ * id). Every slot maps to a name id, names are string_views into the raw records, deduplicated while indexing.
+ * Classify runs the matcher once per unique name and copies the flags into every slot, so checking whether a slot
+ * is a selected mob is one array read. Nothing is copied or sorted for display here, see NameArena.
+ */
+class MobTable final
+{
+public:
+    static constexpr uint32_t Slots = 1024;
+    static constexpr uint32_t RecordSize = 0x20;
+    static constexpr uint32_t NameSize = 0x1C;
+    static constexpr uint16_t NoName = 0xFFFF;
+
+private:
+    std::pmr::vector<char> records;
+    std::array<uint16_t, Slots> slot_names;
+    std::array<uint8_t, Slots> slot_flags{};
+    std::pmr::vector<std::string_view> names;
+    std::pmr::vector<uint8_t> name_flags;
+
+public:
+    explicit MobTable(std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+        : records(resource)
+        , names(resource)
+        , name_flags(resource)
+    {
+        slot_names.fill(NoName);
+    }
+    ~MobTable(void) {}
+
+    /**
+     * Empties the table and sizes the record buffer.
+     *
+     * @return {char*} Where to read the DAT to, bytes long.
+     */
+    char* Prepare(size_t bytes)
+    {
+        names.clear();
+        name_flags.clear();
+        slot_names.fill(NoName);
+        slot_flags.fill(Matcher::None);
+
+        records.assign(bytes - bytes % RecordSize, 0);
+
+        return records.data();
+    }
+
+    /**
+     * Indexes the records read into the Prepare buffer.
+     *
+     * @param {F} skip - Invoked as skip(std::string_view name), true to leave the slot without a name.
+     */
+    template <typename F>
+    void Index(F&& skip)
+    {
+        const uint32_t count = Records();
+
+        names.reserve(count);
+
+        std::pmr::vector<uint16_t> table(Buckets(count), NoName, records.get_allocator());
+        const uint32_t mask = uint32_t(table.size() - 1);
+
+        for (uint32_t n = 0; n < count; n++)
+        {
+            const char* record = records.data() + size_t(n) * RecordSize;
+
+            uint32_t server_id = 0;
+            ::memcpy(&server_id, record + NameSize, sizeof(server_id));
+
+            const uint32_t index = server_id & 0x07FF;
+            const std::string_view name = Trim(std::string_view(record, ::strnlen(record, NameSize)));
+
+            if (index >= Slots || skip(name))
+            {
+                continue;
+            }
+
+            // DEDUPLICATE, OPEN ADDRESSING
+            uint32_t bucket = Hash(name) & mask;
+
+            while (table[bucket] != NoName && names[table[bucket]] != name)
+            {
+                bucket = (bucket + 1) & mask;
+            }
+
+            if (table[bucket] == NoName)
+            {
+                table[bucket] = uint16_t(names.size());
+                names.push_back(name);
+            }
+
+            slot_names[index] = table[bucket];
+        }
+
+        name_flags.assign(names.size(), Matcher::None);
+    }
+
+    /**
+     * Classifies every unique name once and updates the slot flags.
+     */
+    void Classify(const Matcher& matcher)
+    {
+        for (size_t n = 0; n < names.size(); n++)
+        {
+            name_flags[n] = matcher.Classify(names[n]);
+        }
+
+        for (uint32_t index = 0; index < Slots; index++)
+        {
+            slot_flags[index] = slot_names[index] != NoName ? uint8_t(name_flags[slot_names[index]]) : uint8_t(Matcher::None);
+        }
+    }
+
+    bool Contains(uint32_t index) const
+    {
+        return index < Slots && slot_names[index] != NoName;
+    }
+
+    /**
+     * @return {uint8_t} Matcher flags of the slot's name, None for slots outside the table.
+     */
+    uint8_t Flags(uint32_t index) const
+    {
+        return index < Slots ? uint8_t(slot_flags[index]) : uint8_t(Matcher::None);
+    }
+
+    uint16_t Name(uint32_t index) const
+    {
+        return index < Slots ? slot_names[index] : NoName;
+    }
+
+    /**
+     * @return {std::string_view} The name, not NUL terminated. (A view into the raw records.)
+     */
+    std::string_view NameAt(uint16_t id) const
+    {
+        return names[id];
+    }
+
+    uint32_t Records() const
+    {
+        return uint32_t(records.size() / RecordSize);
+    }
+
+    size_t NameCount() const
+    {
+        return names.size();
+    }
+
+private:
+    static size_t Buckets(size_t count)
+    {
+        size_t buckets = 16;
+
+        while (buckets < count * 2)
+        {
+            buckets <<= 1;
+        }
+
+        return buckets;
+    }
+
+    static std::string_view Trim(std::string_view name)
+    {
+        while (!name.empty() && (name.front() == ' ' || name.front() == '\t'))
+        {
+            name.remove_prefix(1);
+        }
+
+        while (!name.empty() && (name.back() == ' ' || name.back() == '\t'))
+        {
+            name.remove_suffix(1);
+        }
+
+        return name;
+    }
+
+    static uint32_t Hash(std::string_view name)
+    {
+        // FNV-1a
+        uint32_t hash = 2166136261u;
+
+        for (const char c : name)
+        {
+            hash = (hash ^ uint8_t(c)) * 16777619u;
+        }
+
+        return hash;
+    }
+};
+
+#endif // MOB_TABLE_H_INCLUDED
@@ -0,0 +1,141 @@
+#ifndef NAME_ARENA_H_INCLUDED
+#define NAME_ARENA_H_INCLUDED
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <algorithm>
+#include <cstdint>
+#include <memory_resource>
+#include <string_view>
+#include <vector>
+
+/**
+ * NameArena Class Implementation
+ *
+ * Unique, sorted zone mob names stored back to back in a single contiguous buffer. Names are NUL terminated inside
+ * the arena so the string_view handles can be passed straight to ImGui.
+ *
+ * Reserve must be called with the upper bound of names and bytes before any name is added. The arena never grows
+ * past that, so the handles stay valid and a zone load costs a fixed number of allocations no matter how many
+ * records the DAT holds. Duplicates are dropped through an open addressing hash table, then the handles are sorted
+ * once by Sort.
+ */
+class NameArena final
+{
+    std::pmr::vector<char> arena;
+    std::pmr::vector<std::string_view> names;
+    std::pmr::vector<uint32_t> table;   // Index + 1 into names, 0 = empty slot.
+    uint32_t mask;
+
+public:
+    explicit NameArena(std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+        : arena(resource)
+        , names(resource)
+        , table(resource)
+        , mask(0)
+    {}
+    ~NameArena(void) {}
+
+    void Reserve(size_t count, size_t bytes)
+    {
+        Clear();
+
+        arena.reserve(bytes + count);
+        names.reserve(count);
+
+        size_t slots = 16;
+        while (slots < count * 2)
+        {
+            slots <<= 1;
+        }
+
+        table.assign(slots, 0);
+        mask = uint32_t(slots - 1);
+    }
+
+    void Clear()
+    {
+        arena.clear();
+        names.clear();
+        table.clear();
+        mask = 0;
+    }
+
+    /**
+     * Adds a name unless it is already present.
+     *
+     * @return {bool} True if the name was added, false if it was a duplicate or the arena is full.
+     */
+    bool Add(std::string_view name)
+    {
+        if (table.empty() || names.size() == names.capacity() || arena.size() + name.size() + 1 > arena.capacity())
+        {
+            return false;
+        }
+
+        uint32_t slot = Hash(name) & mask;
+
+        while (table[slot] != 0)
+        {
+            if (names[table[slot] - 1] == name)
+            {
+                return false;
+            }
+
+            slot = (slot + 1) & mask;
+        }
+
+        const size_t offset = arena.size();
+
+        arena.insert(arena.end(), name.begin(), name.end());
+        arena.push_back('\0');
+
+        names.emplace_back(arena.data() + offset, name.size());
+        table[slot] = uint32_t(names.size());
+
+        return true;
+    }
+
+    void Sort()
+    {
+        std::sort(names.begin(), names.end());
+
+        // THE TABLE POINTS AT POSITIONS, IT IS ONLY NEEDED WHILE LOADING
+        table.clear();
+        table.shrink_to_fit();
+        mask = 0;
+    }
+
+    size_t size() const
+    {
+        return names.size();
+    }
+
+    size_t bytes() const
+    {
+        return arena.capacity() + names.capacity() * sizeof(std::string_view) + table.capacity() * sizeof(uint32_t);
+    }
+
+    const std::string_view& operator[](size_t index) const
+    {
+        return names[index];
+    }
+
+private:
+    static uint32_t Hash(std::string_view name)
+    {
+        // FNV-1a
+        uint32_t hash = 2166136261u;
+
+        for (const char c : name)
+        {
+            hash = (hash ^ uint8_t(c)) * 16777619u;
+        }
+
+        return hash;
+    }
+};
+
+#endif // NAME_ARENA_H_INCLUDED
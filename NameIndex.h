@@ -0,0 +1,255 @@
+#ifndef NAME_INDEX_H_INCLUDED
+#define NAME_INDEX_H_INCLUDED
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <algorithm>
+#include <cstdint>
+#include <memory_resource>
+#include <string_view>
+#include <vector>
+
+#include "NameArena.h"
+
+/**
+ * NameIndex Class Implementation
+ *
+ * Case insensitive n-gram index over the zone's unique names, for the incremental target search.
+ *
+ * Every 1, 2 and 3 byte gram of every lower cased name is a key, and each key owns a posting list of the name ids
+ * (positions in the sorted NameArena) it occurs in, ascending. Keys are sorted and the lists are stored back to back
+ * in one buffer. A gram is packed with its length into the key itself, so keys never collide.
+ *
+ * A query takes the grams of the query at the longest indexed length, walks the shortest of their posting lists and
+ * checks only those names for the whole query. A gram that is not in the index means nothing matches.
+ */
+class NameIndex final
+{
+public:
+    static constexpr uint32_t MaxGram = 3;
+    static constexpr size_t MaxQuery = 64;
+
+private:
+    const NameArena* names;
+    std::pmr::vector<uint32_t> keys;        // Every distinct gram, ascending.
+    std::pmr::vector<uint32_t> offsets;     // Posting list of keys[n] is postings[offsets[n], offsets[n + 1]).
+    std::pmr::vector<uint16_t> postings;
+
+public:
+    explicit NameIndex(std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+        : names(nullptr)
+        , keys(resource)
+        , offsets(resource)
+        , postings(resource)
+    {}
+    ~NameIndex(void) {}
+
+    /**
+     * Indexes every name, the arena must stay sorted and alive while the index is used.
+     *
+     * The (gram, name) pairs are sorted in a temporary heap buffer that is freed before returning, only the final
+     * index is allocated from the resource.
+     */
+    void Build(const NameArena& arena)
+    {
+        names = &arena;
+
+        std::vector<uint64_t> pairs;
+        size_t grams = 0;
+
+        for (size_t n = 0; n < arena.size(); n++)
+        {
+            grams += arena[n].size() * MaxGram;
+        }
+
+        pairs.reserve(grams);
+
+        ForEachGram([&pairs](uint32_t key, uint32_t id)
+        {
+            pairs.push_back(uint64_t(key) << 32 | id);
+        });
+
+        // SORTED BY GRAM THEN NAME, A GRAM REPEATED IN ONE NAME IS ONLY POSTED ONCE
+        std::sort(pairs.begin(), pairs.end());
+        pairs.erase(std::unique(pairs.begin(), pairs.end()), pairs.end());
+
+        keys.clear();
+        offsets.clear();
+        postings.clear();
+        postings.reserve(pairs.size());
+
+        for (const uint64_t pair : pairs)
+        {
+            const uint32_t key = uint32_t(pair >> 32);
+
+            if (keys.empty() || keys.back() != key)
+            {
+                keys.push_back(key);
+                offsets.push_back(uint32_t(postings.size()));
+            }
+
+            postings.push_back(uint16_t(pair));
+        }
+
+        offsets.push_back(uint32_t(postings.size()));
+    }
+
+    void Clear()
+    {
+        names = nullptr;
+        keys.clear();
+        offsets.clear();
+        postings.clear();
+    }
+
+    /**
+     * Invokes f(id) for every name containing the query, ignoring case, in name order.
+     */
+    template <typename F>
+    void Query(std::string_view query, F&& f) const
+    {
+        if (names == nullptr)
+        {
+            return;
+        }
+
+        char lower[MaxQuery];
+        const size_t length = std::min(query.size(), MaxQuery);
+
+        for (size_t n = 0; n < length; n++)
+        {
+            lower[n] = Lower(query[n]);
+        }
+
+        if (length == 0)
+        {
+            for (size_t id = 0; id < names->size(); id++)
+            {
+                f(uint32_t(id));
+            }
+
+            return;
+        }
+
+        // THE SHORTEST POSTING LIST OF THE QUERY'S GRAMS
+        const size_t gram = std::min<size_t>(length, MaxGram);
+        size_t shortest = keys.size();
+
+        for (size_t n = 0; n + gram <= length; n++)
+        {
+            const size_t at = Find(Key(lower + n, gram));
+
+            if (at == keys.size())
+            {
+                return;
+            }
+
+            if (shortest == keys.size() || Count(at) < Count(shortest))
+            {
+                shortest = at;
+            }
+        }
+
+        const std::string_view needle(lower, length);
+
+        for (uint32_t n = offsets[shortest]; n < offsets[shortest + 1]; n++)
+        {
+            const uint16_t id = postings[n];
+
+            if (gram == length || Contains((*names)[id], needle))
+            {
+                f(uint32_t(id));
+            }
+        }
+    }
+
+    size_t bytes() const
+    {
+        return keys.capacity() * sizeof(uint32_t) + offsets.capacity() * sizeof(uint32_t) + postings.capacity() * sizeof(uint16_t);
+    }
+
+private:
+    template <typename F>
+    void ForEachGram(F&& f) const
+    {
+        char lower[MaxQuery];
+
+        for (size_t id = 0; id < names->size(); id++)
+        {
+            const std::string_view name = (*names)[id];
+            const size_t length = std::min(name.size(), MaxQuery);
+
+            for (size_t n = 0; n < length; n++)
+            {
+                lower[n] = Lower(name[n]);
+            }
+
+            for (size_t gram = 1; gram <= MaxGram; gram++)
+            {
+                for (size_t n = 0; n + gram <= length; n++)
+                {
+                    f(Key(lower + n, gram), uint32_t(id));
+                }
+            }
+        }
+    }
+
+    /**
+     * @return {size_t} Position of the key, keys.size() if it is not indexed.
+     */
+    size_t Find(uint32_t key) const
+    {
+        const auto at = std::lower_bound(keys.begin(), keys.end(), key);
+
+        return at != keys.end() && *at == key ? size_t(at - keys.begin()) : keys.size();
+    }
+
+    uint32_t Count(size_t at) const
+    {
+        return offsets[at + 1] - offsets[at];
+    }
+
+    /**
+     * @param {std::string_view} needle - Already lower cased.
+     */
+    static bool Contains(std::string_view name, std::string_view needle)
+    {
+        for (size_t at = 0; at + needle.size() <= name.size(); at++)
+        {
+            size_t n = 0;
+
+            while (n < needle.size() && Lower(name[at + n]) == needle[n])
+            {
+                n++;
+            }
+
+            if (n == needle.size())
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    static uint32_t Key(const char* gram, size_t length)
+    {
+        uint32_t key = uint32_t(length) << 24;
+
+        for (size_t n = 0; n < length; n++)
+        {
+            key |= uint32_t(uint8_t(gram[n])) << (8 * (2 - n));
+        }
+
+        return key;
+    }
+
+    static char Lower(char c)
+    {
+        return c >= 'A' && c <= 'Z' ? char(c - 'A' + 'a') : c;
+    }
+};
+
+#endif // NAME_INDEX_H_INCLUDED
@@ -0,0 +1,695 @@
+#ifndef NAV_GRID_H_INCLUDED
+#define NAV_GRID_H_INCLUDED
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <limits>
+#include <vector>
+
+/**
+ * NavGrid Class Implementation
+ *
+ * Walkable surface of a zone as a layered height grid, built once from the zone's collision triangles and then
+ * only read. Each 1 yalm cell holds up to Layers walkable heights (a floor and a bridge or ledge above it), stored
+ * in 1/16 yalm, plus a bit per layer that is set when a wall crosses the layer's headroom.
+ *
+ * Two layers in neighbouring cells are connected when their heights differ by at most MaxStep and neither is
+ * blocked. FindPath runs A* over those connections inside a bounded window around both ends, then pulls the
+ * string so only the corners the straight line cannot see remain as waypoints.
+ *
+ * Coordinates are the same as entity positions: x and y across the ground, z up.
+ */
+class NavGrid final
+{
+public:
+    struct Point
+    {
+        float x;
+        float y;
+        float z;
+    };
+
+    static constexpr uint32_t Layers = 2;
+    static constexpr float CellSize = 1.0f;
+    static constexpr float HeightScale = 16.0f;         // Heights are stored in 1/16 yalm.
+    static constexpr float MaxStep = 0.75f;             // Highest ledge walked up or down between cells.
+    static constexpr float AgentHeight = 2.0f;          // Headroom a layer needs clear of walls.
+    static constexpr float MinUp = 0.7f;                // Minimum up component of a walkable face normal. (~45 degrees)
+    static constexpr uint32_t MaxSide = 4096;           // Largest grid side in cells.
+
+    static constexpr uint32_t Window = 256;             // Largest search window side in cells.
+    static constexpr uint32_t MaxExpansions = 32768;
+
+    static constexpr uint32_t Magic = 0x56414E53;       // "SNAV"
+    static constexpr uint32_t Version = 1;
+
+    /**
+     * Scratch memory for FindPath, sized for the largest window once and reused by every query. One per thread.
+     */
+    class Query final
+    {
+        friend class NavGrid;
+
+        struct Open
+        {
+            float f;
+            uint32_t node;
+
+            bool operator<(const Open& other) const
+            {
+                return f > other.f;
+            }
+        };
+
+        std::vector<float> g;
+        std::vector<uint32_t> parent;
+        std::vector<uint32_t> stamp;
+        std::vector<Open> open;
+        std::vector<uint32_t> nodes;
+        uint32_t epoch = 0;
+
+    public:
+        Query(void)
+            : g(Window * Window * Layers)
+            , parent(Window * Window * Layers)
+            , stamp(Window * Window * Layers)
+        {
+            open.reserve(4096);
+            nodes.reserve(1024);
+        }
+        ~Query(void) {}
+    };
+
+private:
+    static constexpr int16_t None = std::numeric_limits<int16_t>::min();
+
+    float origin_x;
+    float origin_y;
+    uint32_t width;
+    uint32_t height;
+    std::vector<int16_t> heights;       // (y * width + x) * Layers + layer, None where nothing is walkable.
+    std::vector<uint8_t> blocked;       // y * width + x, bit n set when layer n is blocked by a wall.
+
+public:
+    NavGrid(void)
+        : origin_x(0)
+        , origin_y(0)
+        , width(0)
+        , height(0)
+    {}
+    ~NavGrid(void) {}
+
+    uint32_t Width() const
+    {
+        return width;
+    }
+
+    uint32_t Height() const
+    {
+        return height;
+    }
+
+    size_t Bytes() const
+    {
+        return heights.size() * sizeof(int16_t) + blocked.size();
+    }
+
+    /**
+     * Rasterizes a triangle soup into the grid. Faces steeper than MinUp are treated as walls.
+     *
+     * @param {const std::vector<Point>&} vertices - The mesh vertices.
+     * @param {const std::vector<uint32_t>&} indices - Three vertex indices per triangle.
+     * @param {const std::atomic<bool>&} cancel - Polled while building, the build gives up once it is set.
+     * @return {bool} True if the grid was built, false if the mesh is empty, too large or the build was cancelled.
+     */
+    bool Build(const std::vector<Point>& vertices, const std::vector<uint32_t>& indices, const std::atomic<bool>& cancel)
+    {
+        if (vertices.empty() || indices.size() < 3)
+        {
+            return false;
+        }
+
+        float min_x = vertices[0].x, max_x = vertices[0].x;
+        float min_y = vertices[0].y, max_y = vertices[0].y;
+
+        for (const Point& v : vertices)
+        {
+            min_x = std::min(min_x, v.x);
+            max_x = std::max(max_x, v.x);
+            min_y = std::min(min_y, v.y);
+            max_y = std::max(max_y, v.y);
+        }
+
+        origin_x = min_x;
+        origin_y = min_y;
+        width = uint32_t((max_x - min_x) / CellSize) + 1;
+        height = uint32_t((max_y - min_y) / CellSize) + 1;
+
+        if (width > MaxSide || height > MaxSide)
+        {
+            return false;
+        }
+
+        heights.assign(size_t(width) * height * Layers, None);
+        blocked.assign(size_t(width) * height, 0);
+
+        // WALL HEIGHT RANGE PER CELL, ONLY NEEDED WHILE BUILDING
+        std::vector<float> wall_low(size_t(width) * height, std::numeric_limits<float>::max());
+        std::vector<float> wall_high(size_t(width) * height, std::numeric_limits<float>::lowest());
+
+        for (size_t n = 0; n + 2 < indices.size(); n += 3)
+        {
+            if ((n & 0xFFF) == 0 && cancel.load(std::memory_order_relaxed))
+            {
+                return false;
+            }
+
+            if (indices[n] >= vertices.size() || indices[n + 1] >= vertices.size() || indices[n + 2] >= vertices.size())
+            {
+                continue;
+            }
+
+            const Point& a = vertices[indices[n]];
+            const Point& b = vertices[indices[n + 1]];
+            const Point& c = vertices[indices[n + 2]];
+
+            const float ux = b.x - a.x, uy = b.y - a.y, uz = b.z - a.z;
+            const float vx = c.x - a.x, vy = c.y - a.y, vz = c.z - a.z;
+            const float nx = uy * vz - uz * vy;
+            const float ny = uz * vx - ux * vz;
+            const float nz = ux * vy - uy * vx;
+            const float length = std::sqrt(nx * nx + ny * ny + nz * nz);
+
+            if (length <= 0)
+            {
+                continue;
+            }
+
+            if (std::abs(nz) / length >= MinUp)
+            {
+                RasterizeFloor(a, b, c);
+            }
+            else
+            {
+                RasterizeWall(a, b, c, wall_low, wall_high);
+            }
+        }
+
+        // A WALL INSIDE A LAYER'S HEADROOM BLOCKS IT
+        for (size_t cell = 0; cell < blocked.size(); cell++)
+        {
+            if (wall_low[cell] > wall_high[cell])
+            {
+                continue;
+            }
+
+            for (uint32_t layer = 0; layer < Layers; layer++)
+            {
+                const int16_t h = heights[cell * Layers + layer];
+
+                if (h != None && wall_high[cell] > Unpack(h) + MaxStep && wall_low[cell] < Unpack(h) + AgentHeight)
+                {
+                    blocked[cell] |= uint8_t(1 << layer);
+                }
+            }
+        }
+
+        return true;
+    }
+
+    bool Save(const char* path) const
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+
+        if (!file)
+        {
+            return false;
+        }
+
+        const uint32_t header[4] = { Magic, Version, width, height };
+        const float origin[2] = { origin_x, origin_y };
+
+        file.write(reinterpret_cast<const char*>(header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(origin), sizeof(origin));
+        file.write(reinterpret_cast<const char*>(heights.data()), std::streamsize(heights.size() * sizeof(int16_t)));
+        file.write(reinterpret_cast<const char*>(blocked.data()), std::streamsize(blocked.size()));
+
+        return bool(file);
+    }
+
+    bool Load(const char* path)
+    {
+        std::ifstream file(path, std::ios::binary);
+
+        if (!file)
+        {
+            return false;
+        }
+
+        uint32_t header[4]{};
+        float origin[2]{};
+
+        file.read(reinterpret_cast<char*>(header), sizeof(header));
+        file.read(reinterpret_cast<char*>(origin), sizeof(origin));
+
+        if (!file || header[0] != Magic || header[1] != Version || header[2] == 0 || header[3] == 0 || header[2] > MaxSide || header[3] > MaxSide)
+        {
+            return false;
+        }
+
+        width = header[2];
+        height = header[3];
+        origin_x = origin[0];
+        origin_y = origin[1];
+
+        heights.resize(size_t(width) * height * Layers);
+        blocked.resize(size_t(width) * height);
+
+        file.read(reinterpret_cast<char*>(heights.data()), std::streamsize(heights.size() * sizeof(int16_t)));
+        file.read(reinterpret_cast<char*>(blocked.data()), std::streamsize(blocked.size()));
+
+        return bool(file);
+    }
+
+    /**
+     * Finds a walkable path and writes its waypoints, ending at to.
+     *
+     * @param {Query&} query - Scratch memory, owned by the calling thread.
+     * @param {const Point&} from - The start, usually the player.
+     * @param {const Point&} to - The goal.
+     * @param {std::vector<Point>&} out - Receives the waypoints, excluding from.
+     * @return {bool} True if a path was found, false if either end is off the grid, the ends are too far apart or
+     *      the goal is unreachable within MaxExpansions.
+     */
+    bool FindPath(Query& query, const Point& from, const Point& to, std::vector<Point>& out) const
+    {
+        out.clear();
+
+        uint32_t start = 0;
+        uint32_t goal = 0;
+
+        if (!Locate(from, start) || !Locate(to, goal))
+        {
+            return false;
+        }
+
+        // SEARCH WINDOW CENTERED BETWEEN BOTH ENDS, LEAVING ROOM TO DETOUR
+        const int32_t sx = int32_t(start / Layers % width), sy = int32_t(start / Layers / width);
+        const int32_t gx = int32_t(goal / Layers % width), gy = int32_t(goal / Layers / width);
+
+        if (std::abs(sx - gx) >= int32_t(Window) || std::abs(sy - gy) >= int32_t(Window))
+        {
+            return false;
+        }
+
+        const int32_t ww = std::min(int32_t(width), int32_t(Window));
+        const int32_t wh = std::min(int32_t(height), int32_t(Window));
+        const int32_t wx = std::clamp((sx + gx) / 2 - ww / 2, 0, int32_t(width) - ww);
+        const int32_t wy = std::clamp((sy + gy) / 2 - wh / 2, 0, int32_t(height) - wh);
+
+        auto local = [&](uint32_t node)
+        {
+            const int32_t x = int32_t(node / Layers % width) - wx;
+            const int32_t y = int32_t(node / Layers / width) - wy;
+            return uint32_t((y * ww + x) * int32_t(Layers) + int32_t(node % Layers));
+        };
+
+        auto heuristic = [&](uint32_t node)
+        {
+            const float dx = std::abs(float(int32_t(node / Layers % width) - gx));
+            const float dy = std::abs(float(int32_t(node / Layers / width) - gy));
+            return std::max(dx, dy) + 0.4142f * std::min(dx, dy);
+        };
+
+        if (++query.epoch == 0)
+        {
+            std::fill(query.stamp.begin(), query.stamp.end(), 0);
+            query.epoch = 1;
+        }
+
+        query.open.clear();
+
+        query.stamp[local(start)] = query.epoch;
+        query.g[local(start)] = 0;
+        query.parent[local(start)] = start;
+        query.open.push_back({ heuristic(start), start });
+
+        bool found = false;
+
+        for (uint32_t expansions = 0; !query.open.empty() && expansions < MaxExpansions; expansions++)
+        {
+            std::pop_heap(query.open.begin(), query.open.end());
+            const typename Query::Open current = query.open.back();
+            query.open.pop_back();
+
+            if (current.node == goal)
+            {
+                found = true;
+                break;
+            }
+
+            const uint32_t cl = local(current.node);
+
+            // STALE HEAP ENTRY
+            if (current.f > query.g[cl] + heuristic(current.node) + 0.001f)
+            {
+                continue;
+            }
+
+            const int32_t cx = int32_t(current.node / Layers % width);
+            const int32_t cy = int32_t(current.node / Layers / width);
+            const float ch = Unpack(heights[current.node]);
+
+            for (int32_t dy = -1; dy <= 1; dy++)
+            {
+                for (int32_t dx = -1; dx <= 1; dx++)
+                {
+                    const int32_t nx = cx + dx;
+                    const int32_t ny = cy + dy;
+
+                    if ((dx == 0 && dy == 0) || nx < wx || ny < wy || nx >= wx + ww || ny >= wy + wh)
+                    {
+                        continue;
+                    }
+
+                    // NO CUTTING CORNERS
+                    if (dx != 0 && dy != 0 && (Step(cx + dx, cy, ch) < 0 || Step(cx, cy + dy, ch) < 0))
+                    {
+                        continue;
+                    }
+
+                    const int32_t layer = Step(nx, ny, ch);
+
+                    if (layer < 0)
+                    {
+                        continue;
+                    }
+
+                    const uint32_t next = (uint32_t(ny) * width + uint32_t(nx)) * Layers + uint32_t(layer);
+                    const uint32_t nl = local(next);
+                    const float cost = query.g[cl] + (dx != 0 && dy != 0 ? 1.4142f : 1.0f);
+
+                    if (query.stamp[nl] == query.epoch && query.g[nl] <= cost)
+                    {
+                        continue;
+                    }
+
+                    query.stamp[nl] = query.epoch;
+                    query.g[nl] = cost;
+                    query.parent[nl] = current.node;
+                    query.open.push_back({ cost + heuristic(next), next });
+                    std::push_heap(query.open.begin(), query.open.end());
+                }
+            }
+        }
+
+        if (!found)
+        {
+            return false;
+        }
+
+        // WALK BACK FROM THE GOAL
+        query.nodes.clear();
+
+        for (uint32_t node = goal; node != start; node = query.parent[local(node)])
+        {
+            query.nodes.push_back(node);
+        }
+
+        query.nodes.push_back(start);
+        std::reverse(query.nodes.begin(), query.nodes.end());
+
+        // PULL THE STRING, ONLY KEEP CORNERS THE LAST WAYPOINT CANNOT SEE PAST
+        size_t anchor = 0;
+
+        for (size_t n = 2; n < query.nodes.size(); n++)
+        {
+            if (!Visible(query.nodes[anchor], query.nodes[n]))
+            {
+                anchor = n - 1;
+                out.push_back(Center(query.nodes[anchor]));
+            }
+        }
+
+        out.push_back(to);
+
+        return true;
+    }
+
+private:
+    static int16_t Pack(float z)
+    {
+        return int16_t(std::clamp(z * HeightScale, -32767.0f, 32767.0f));
+    }
+
+    static float Unpack(int16_t h)
+    {
+        return float(h) / HeightScale;
+    }
+
+    Point Center(uint32_t node) const
+    {
+        const uint32_t cell = node / Layers;
+
+        return Point{ origin_x + (float(cell % width) + 0.5f) * CellSize, origin_y + (float(cell / width) + 0.5f) * CellSize, Unpack(heights[node]) };
+    }
+
+    /**
+     * Finds the layer at p, the walkable height closest to p.z within AgentHeight. Falls back to the neighbouring
+     * cells, mobs and players often stand on the edge of a surface.
+     */
+    bool Locate(const Point& p, uint32_t& node) const
+    {
+        const int32_t x = int32_t((p.x - origin_x) / CellSize);
+        const int32_t y = int32_t((p.y - origin_y) / CellSize);
+
+        float best = AgentHeight;
+        bool found = false;
+
+        for (int32_t ring = 0; ring <= 1 && !found; ring++)
+        {
+            for (int32_t dy = -ring; dy <= ring; dy++)
+            {
+                for (int32_t dx = -ring; dx <= ring; dx++)
+                {
+                    const int32_t cx = x + dx;
+                    const int32_t cy = y + dy;
+
+                    if (cx < 0 || cy < 0 || cx >= int32_t(width) || cy >= int32_t(height))
+                    {
+                        continue;
+                    }
+
+                    const uint32_t cell = uint32_t(cy) * width + uint32_t(cx);
+
+                    for (uint32_t layer = 0; layer < Layers; layer++)
+                    {
+                        const int16_t h = heights[cell * Layers + layer];
+
+                        if (h == None || (blocked[cell] & (1 << layer)) != 0)
+                        {
+                            continue;
+                        }
+
+                        const float d = std::abs(Unpack(h) - p.z);
+
+                        if (d <= best)
+                        {
+                            best = d;
+                            node = cell * Layers + layer;
+                            found = true;
+                        }
+                    }
+                }
+            }
+        }
+
+        return found;
+    }
+
+    /**
+     * Returns the open layer of cell (x, y) reachable from height h, -1 if there is none.
+     */
+    int32_t Step(int32_t x, int32_t y, float h) const
+    {
+        if (x < 0 || y < 0 || x >= int32_t(width) || y >= int32_t(height))
+        {
+            return -1;
+        }
+
+        const uint32_t cell = uint32_t(y) * width + uint32_t(x);
+
+        for (uint32_t layer = 0; layer < Layers; layer++)
+        {
+            const int16_t n = heights[cell * Layers + layer];
+
+            if (n != None && (blocked[cell] & (1 << layer)) == 0 && std::abs(Unpack(n) - h) <= MaxStep)
+            {
+                return int32_t(layer);
+            }
+        }
+
+        return -1;
+    }
+
+    /**
+     * Walks the straight line between two nodes in half cell steps, following the surface.
+     */
+    bool Visible(uint32_t from, uint32_t to) const
+    {
+        const float x0 = float(from / Layers % width) + 0.5f, y0 = float(from / Layers / width) + 0.5f;
+        const float x1 = float(to / Layers % width) + 0.5f, y1 = float(to / Layers / width) + 0.5f;
+        const uint32_t steps = uint32_t(std::max(std::abs(x1 - x0), std::abs(y1 - y0)) * 2) + 1;
+
+        float h = Unpack(heights[from]);
+
+        for (uint32_t n = 1; n <= steps; n++)
+        {
+            const float t = float(n) / float(steps);
+            const int32_t x = int32_t(x0 + (x1 - x0) * t);
+            const int32_t y = int32_t(y0 + (y1 - y0) * t);
+            const int32_t layer = Step(x, y, h);
+
+            if (layer < 0)
+            {
+                return false;
+            }
+
+            h = Unpack(heights[(uint32_t(y) * width + uint32_t(x)) * Layers + uint32_t(layer)]);
+        }
+
+        return true;
+    }
+
+    void InsertLayer(uint32_t cell, float z)
+    {
+        int16_t* layers = &heights[size_t(cell) * Layers];
+        const int16_t h = Pack(z);
+
+        // SAME SURFACE (OVERLAPPING TRIANGLES), KEEP THE TOP
+        for (uint32_t layer = 0; layer < Layers; layer++)
+        {
+            if (layers[layer] != None && std::abs(Unpack(layers[layer]) - z) < AgentHeight)
+            {
+                layers[layer] = std::max(layers[layer], h);
+                return;
+            }
+        }
+
+        // NEW SURFACE, KEEP THE HIGHEST LAYERS
+        uint32_t lowest = 0;
+
+        for (uint32_t layer = 0; layer < Layers; layer++)
+        {
+            if (layers[layer] == None)
+            {
+                layers[layer] = h;
+                return;
+            }
+
+            if (layers[layer] < layers[lowest])
+            {
+                lowest = layer;
+            }
+        }
+
+        if (h > layers[lowest])
+        {
+            layers[lowest] = h;
+        }
+    }
+
+    void RasterizeFloor(const Point& a, const Point& b, const Point& c)
+    {
+        const int32_t x0 = std::max(0, int32_t((std::min({ a.x, b.x, c.x }) - origin_x) / CellSize));
+        const int32_t y0 = std::max(0, int32_t((std::min({ a.y, b.y, c.y }) - origin_y) / CellSize));
+        const int32_t x1 = std::min(int32_t(width) - 1, int32_t((std::max({ a.x, b.x, c.x }) - origin_x) / CellSize));
+        const int32_t y1 = std::min(int32_t(height) - 1, int32_t((std::max({ a.y, b.y, c.y }) - origin_y) / CellSize));
+
+        const float area = (b.x - a.x) * (c.y - a.y) - (c.x - a.x) * (b.y - a.y);
+
+        if (area == 0)
+        {
+            return;
+        }
+
+        bool covered = false;
+
+        for (int32_t y = y0; y <= y1; y++)
+        {
+            for (int32_t x = x0; x <= x1; x++)
+            {
+                const float px = origin_x + (float(x) + 0.5f) * CellSize;
+                const float py = origin_y + (float(y) + 0.5f) * CellSize;
+
+                const float w0 = ((b.x - px) * (c.y - py) - (c.x - px) * (b.y - py)) / area;
+                const float w1 = ((c.x - px) * (a.y - py) - (a.x - px) * (c.y - py)) / area;
+                const float w2 = 1.0f - w0 - w1;
+
+                if (w0 < 0 || w1 < 0 || w2 < 0)
+                {
+                    continue;
+                }
+
+                InsertLayer(uint32_t(y) * width + uint32_t(x), w0 * a.z + w1 * b.z + w2 * c.z);
+                covered = true;
+            }
+        }
+
+        // SMALLER THAN A CELL, STILL COUNTS FOR THE CELL IT SITS IN
+        if (!covered)
+        {
+            const float cx = (a.x + b.x + c.x) / 3, cy = (a.y + b.y + c.y) / 3;
+            const int32_t x = int32_t((cx - origin_x) / CellSize), y = int32_t((cy - origin_y) / CellSize);
+
+            if (x >= 0 && y >= 0 && x < int32_t(width) && y < int32_t(height))
+            {
+                InsertLayer(uint32_t(y) * width + uint32_t(x), (a.z + b.z + c.z) / 3);
+            }
+        }
+    }
+
+    void RasterizeWall(const Point& a, const Point& b, const Point& c, std::vector<float>& low, std::vector<float>& high)
+    {
+        auto length = [](const Point& p, const Point& q)
+        {
+            return std::sqrt((q.x - p.x) * (q.x - p.x) + (q.y - p.y) * (q.y - p.y) + (q.z - p.z) * (q.z - p.z));
+        };
+
+        // SAMPLE THE FACE EVERY HALF CELL
+        const uint32_t steps = std::min(uint32_t(std::max({ length(a, b), length(b, c), length(c, a) }) / (CellSize * 0.5f)) + 1, 1024u);
+
+        for (uint32_t i = 0; i <= steps; i++)
+        {
+            for (uint32_t j = 0; i + j <= steps; j++)
+            {
+                const float u = float(i) / float(steps);
+                const float v = float(j) / float(steps);
+                const float w = 1.0f - u - v;
+
+                const int32_t x = int32_t((a.x * w + b.x * u + c.x * v - origin_x) / CellSize);
+                const int32_t y = int32_t((a.y * w + b.y * u + c.y * v - origin_y) / CellSize);
+
+                if (x < 0 || y < 0 || x >= int32_t(width) || y >= int32_t(height))
+                {
+                    continue;
+                }
+
+                const float z = a.z * w + b.z * u + c.z * v;
+                const size_t cell = size_t(y) * width + size_t(x);
+
+                low[cell] = std::min(low[cell], z);
+                high[cell] = std::max(high[cell], z);
+            }
+        }
+    }
+};
+
+#endif // NAV_GRID_H_INCLUDED
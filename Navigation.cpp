@@ -0,0 +1,253 @@
+#ifndef NAVIGATION_H_INCLUDED
+#define NAVIGATION_H_INCLUDED
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include "Stockpile.h"
+#include "Zones.h"
+
+/**
+ * Reads the triangles of a Wavefront OBJ. Polygons are fanned into triangles, texture and normal indices ignored.
+ */
+static bool LoadObj(const std::filesystem::path& path, std::vector<NavGrid::Point>& vertices, std::vector<uint32_t>& indices, const std::atomic<bool>& cancel)
+{
+    std::ifstream file(path);
+
+    if (!file)
+    {
+        return false;
+    }
+
+    std::string line;
+
+    for (uint32_t count = 0; std::getline(file, line); count++)
+    {
+        if ((count & 0xFFF) == 0 && cancel.load(std::memory_order_relaxed))
+        {
+            return false;
+        }
+
+        if (line.size() > 2 && line[0] == 'v' && line[1] == ' ')
+        {
+            NavGrid::Point p{};
+
+            if (::sscanf_s(line.c_str() + 2, "%f %f %f", &p.x, &p.y, &p.z) == 3)
+            {
+                vertices.push_back(p);
+            }
+        }
+        else if (line.size() > 2 && line[0] == 'f' && line[1] == ' ')
+        {
+            uint32_t face[32]{};
+            uint32_t corners = 0;
+
+            for (const char* c = line.c_str() + 2; *c != '\0' && corners < 32;)
+            {
+                char* end = nullptr;
+                const long n = ::strtol(c, &end, 10);
+
+                if (end == c)
+                {
+                    break;
+                }
+
+                // 1 BASED, NEGATIVE COUNTS BACK FROM THE LAST VERTEX
+                face[corners++] = n < 0 ? uint32_t(long(vertices.size()) + n) : uint32_t(n - 1);
+
+                // SKIP /vt/vn
+                for (c = end; *c != '\0' && *c != ' ' && *c != '\t'; c++) {}
+                for (; *c == ' ' || *c == '\t'; c++) {}
+            }
+
+            for (uint32_t n = 2; n < corners; n++)
+            {
+                indices.push_back(face[0]);
+                indices.push_back(face[n - 1]);
+                indices.push_back(face[n]);
+            }
+        }
+    }
+
+    return !indices.empty();
+}
+
+/**
+ * Loads the zone's grid from its cache, or builds it from the zone's exported collision mesh and caches it.
+ *
+ * The mesh (<zone>.obj) is the zone's collision geometry exported from its DAT by an external tool, with vertices
+ * in the same space as entity positions. A cache older than the mesh is rebuilt.
+ */
+static std::shared_ptr<const NavGrid> NavBuild(const std::filesystem::path& directory, int zone, const std::atomic<bool>& cancel)
+{
+    auto grid = std::make_shared<NavGrid>();
+
+    const std::filesystem::path cache = directory / std::format("{}.nav", zone);
+    const std::filesystem::path mesh = directory / std::format("{}.obj", zone);
+
+    std::error_code ec{};
+
+    const bool has_cache = std::filesystem::exists(cache, ec);
+    const bool has_mesh = std::filesystem::exists(mesh, ec);
+
+    if (has_cache && (!has_mesh || std::filesystem::last_write_time(cache, ec) >= std::filesystem::last_write_time(mesh, ec)) && grid->Load(cache.string().c_str()))
+    {
+        return grid;
+    }
+
+    std::vector<NavGrid::Point> vertices;
+    std::vector<uint32_t> indices;
+
+    if (!has_mesh || !LoadObj(mesh, vertices, indices, cancel) || !grid->Build(vertices, indices, cancel))
+    {
+        return nullptr;
+    }
+
+    grid->Save(cache.string().c_str());
+
+    return grid;
+}
+
+/**
+ * Starts loading the zone's grid on its own thread. (Render thread, on zone change.)
+ */
+void Stockpile::NavLoad(int zone)
+{
+    NavStop();
+
+    nav_published.reset();
+
+    const std::filesystem::path directory = std::filesystem::path(m_AshitaCore->GetInstallPath()) / "config" / "stockpile" / "nav";
+
+    nav_thread = std::thread([this, directory, zone]
+    {
+        nav_built = NavBuild(directory, zone, nav_cancel);
+        nav_ready.store(true, std::memory_order_release);
+    });
+}
+
+/**
+ * Publishes the grid once the load finished. (Render thread.)
+ */
+void Stockpile::NavPoll()
+{
+    if (!nav_ready.load(std::memory_order_acquire))
+    {
+        return;
+    }
+
+    nav_thread.join();
+    nav_ready.store(false, std::memory_order_relaxed);
+
+    nav_published = std::move(nav_built);
+
+    if (nav_published)
+    {
+        Log(std::format("Navigation: {}x{} yalms. ({} KB)", nav_published->Width(), nav_published->Height(), nav_published->Bytes() / 1024));
+    }
+    else
+    {
+        Log("Navigation: No collision data for this zone, steering straight.");
+    }
+}
+
+void Stockpile::NavStop()
+{
+    if (!nav_thread.joinable())
+    {
+        return;
+    }
+
+    nav_cancel.store(true, std::memory_order_relaxed);
+    nav_thread.join();
+    nav_cancel.store(false, std::memory_order_relaxed);
+
+    nav_ready.store(false, std::memory_order_relaxed);
+    nav_built.reset();
+}
+
+/**
+ * Returns the point to steer at on the way to goal. (Worker thread.)
+ *
+ * Without a grid for the zone that is the goal itself. Otherwise it is the next waypoint of a path around the
+ * obstacles, planned again once the goal moves by more than 2 yalms, every 2 seconds, or when the grid changes.
+ * If no path is found the goal is steered at directly until the next plan.
+ */
+Stockpile::Pos Stockpile::Navigate(const Snapshot& s, const Pos& goal)
+{
+    if (!s.nav)
+    {
+        return goal;
+    }
+
+    if (nav_planned != s.nav || distance(goal, nav_goal) > 2.0f || s.tick_ms >= nav_planned_ms + 2000)
+    {
+        nav_planned = s.nav;
+        nav_goal = goal;
+        nav_planned_ms = s.tick_ms;
+        nav_waypoint = 0;
+
+        s.nav->FindPath(nav_query, { s.player.x, s.player.y, s.player.z }, { goal.x, goal.y, goal.z }, nav_waypoints);
+    }
+
+    // REACHED THE WAYPOINT, ON TO THE NEXT
+    while (nav_waypoint + 1 < nav_waypoints.size() && distance(s.player, Pos{ nav_waypoints[nav_waypoint].x, nav_waypoints[nav_waypoint].y, nav_waypoints[nav_waypoint].z }) < 1.5f)
+    {
+        nav_waypoint++;
+    }
+
+    if (nav_waypoint >= nav_waypoints.size())
+    {
+        return goal;
+    }
+
+    return Pos{ nav_waypoints[nav_waypoint].x, nav_waypoints[nav_waypoint].y, nav_waypoints[nav_waypoint].z };
+}
+
+/**
+ * Pure pursuit over the recorded path. (Worker thread.)
+ *
+ * Returns the point a lookahead distance away on the leg from the current node to the one after it, so the player
+ * curves through a node instead of walking up to it and turning sharply.
+ */
+Stockpile::Pos Stockpile::PursuitPoint(const Snapshot& s, const std::vector<Pos>& path)
+{
+    // PAST WHERE THE PATROL STATE SWITCHES NODES, sqrt(distance) < range_next_path, OR IT NEVER GETS USED
+    const float lookahead = s.settings.range_next_path * s.settings.range_next_path + 1.0f;
+    const Pos& current = path[closest_path_id];
+
+    if (distance(s.player, current) >= lookahead)
+    {
+        return current;
+    }
+
+    const int next_id = reverse_path ? closest_path_id + 1 : closest_path_id - 1;
+
+    if (next_id < 0 || next_id >= int(path.size()))
+    {
+        return current;
+    }
+
+    const Pos& next = path[next_id];
+
+    // SOLVE |current + (next - current) * t - player| = lookahead FOR THE FAR t
+    const float dx = next.x - current.x, dy = next.y - current.y, dz = next.z - current.z;
+    const float fx = current.x - s.player.x, fy = current.y - s.player.y, fz = current.z - s.player.z;
+
+    const float a = dx * dx + dy * dy + dz * dz;
+    const float b = 2 * (fx * dx + fy * dy + fz * dz);
+    const float c = fx * fx + fy * fy + fz * fz - lookahead * lookahead;
+    const float discriminant = b * b - 4 * a * c;
+
+    if (a == 0 || discriminant < 0)
+    {
+        return current;
+    }
+
+    const float t = std::clamp((-b + std::sqrt(discriminant)) / (2 * a), 0.0f, 1.0f);
+
+    return Pos{ current.x + dx * t, current.y + dy * t, current.z + dz * t };
+}
+
+#endif // NAVIGATION_H_INCLUDED
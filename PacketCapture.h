@@ -0,0 +1,261 @@
+#ifndef PACKET_CAPTURE_H_INCLUDED
+#define PACKET_CAPTURE_H_INCLUDED
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+/**
+ * Packet capture file format, little endian:
+ *
+ *      File header     "SPCP" magic (4), version (2), reserved (2)
+ *      Record          time in microseconds (8), direction (1), injected (1), id (2), size (2), size bytes of packet
+ *
+ * Records follow the header back to back until the end of the file. The time is a steady clock, only the differences
+ * between records mean anything.
+ */
+namespace Capture
+{
+    static constexpr char Magic[4] = { 'S', 'P', 'C', 'P' };
+    static constexpr uint16_t Version = 1;
+    static constexpr uint32_t HeaderSize = 8;
+    static constexpr uint32_t RecordSize = 14;
+
+    enum Direction : uint8_t
+    {
+        Incoming = 0,
+        Outgoing = 1,
+    };
+
+    struct Record
+    {
+        uint64_t time_us;
+        uint8_t direction;
+        uint8_t injected;
+        uint16_t id;
+        uint16_t size;
+        const uint8_t* data;
+    };
+}
+
+/**
+ * PacketCapture Class Implementation
+ *
+ * Writes records into a fixed buffer and only touches the file when it fills up or the capture is closed, so the
+ * packet handlers pay a copy per packet and nothing else.
+ */
+class PacketCapture final
+{
+public:
+    static constexpr size_t BufferSize = 64 * 1024;
+
+private:
+    std::ofstream file;
+    std::unique_ptr<uint8_t[]> buffer;
+    size_t used;
+    uint32_t records;
+    uint64_t bytes;
+
+public:
+    PacketCapture(void)
+        : used(0)
+        , records(0)
+        , bytes(0)
+    {}
+    ~PacketCapture(void)
+    {
+        Close();
+    }
+
+    PacketCapture(const PacketCapture&) = delete;
+    PacketCapture& operator=(const PacketCapture&) = delete;
+
+    bool Open(const char* path)
+    {
+        Close();
+
+        file.open(path, std::ios::binary | std::ios::trunc);
+
+        if (!file)
+        {
+            return false;
+        }
+
+        if (!buffer)
+        {
+            buffer = std::make_unique<uint8_t[]>(BufferSize);
+        }
+
+        uint8_t header[Capture::HeaderSize]{};
+        ::memcpy(header, Capture::Magic, sizeof(Capture::Magic));
+        ::memcpy(header + 4, &Capture::Version, sizeof(Capture::Version));
+
+        file.write(reinterpret_cast<const char*>(header), sizeof(header));
+
+        used = 0;
+        records = 0;
+        bytes = Capture::HeaderSize;
+
+        return bool(file);
+    }
+
+    void Write(const Capture::Record& record)
+    {
+        if (!file.is_open())
+        {
+            return;
+        }
+
+        const size_t length = Capture::RecordSize + record.size;
+
+        if (used + length > BufferSize)
+        {
+            Flush();
+        }
+
+        // A PACKET LARGER THAN THE BUFFER GOES STRAIGHT TO THE FILE
+        uint8_t* out = length <= BufferSize ? buffer.get() + used : nullptr;
+        uint8_t header[Capture::RecordSize];
+        uint8_t* at = out != nullptr ? out : header;
+
+        ::memcpy(at + 0, &record.time_us, 8);
+        ::memcpy(at + 8, &record.direction, 1);
+        ::memcpy(at + 9, &record.injected, 1);
+        ::memcpy(at + 10, &record.id, 2);
+        ::memcpy(at + 12, &record.size, 2);
+
+        if (out != nullptr)
+        {
+            ::memcpy(out + Capture::RecordSize, record.data, record.size);
+            used += length;
+        }
+        else
+        {
+            file.write(reinterpret_cast<const char*>(header), sizeof(header));
+            file.write(reinterpret_cast<const char*>(record.data), record.size);
+        }
+
+        records++;
+        bytes += length;
+    }
+
+    void Close()
+    {
+        if (!file.is_open())
+        {
+            return;
+        }
+
+        Flush();
+        file.close();
+    }
+
+    bool IsOpen() const
+    {
+        return file.is_open();
+    }
+
+    uint32_t Records() const
+    {
+        return records;
+    }
+
+    uint64_t Bytes() const
+    {
+        return bytes;
+    }
+
+private:
+    void Flush()
+    {
+        file.write(reinterpret_cast<const char*>(buffer.get()), std::streamsize(used));
+        used = 0;
+    }
+};
+
+/**
+ * CaptureReader Class Implementation
+ *
+ * Reads a whole capture into memory and walks its records, the record data points into the loaded file.
+ */
+class CaptureReader final
+{
+    std::vector<uint8_t> contents;
+    size_t offset;
+
+public:
+    CaptureReader(void)
+        : offset(0)
+    {}
+    ~CaptureReader(void) {}
+
+    /**
+     * @return {bool} False if the file could not be read or is not a capture of this version.
+     */
+    bool Open(const char* path)
+    {
+        std::ifstream file(path, std::ios::binary);
+
+        if (!file)
+        {
+            return false;
+        }
+
+        contents.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+
+        uint16_t version = 0;
+
+        if (contents.size() < Capture::HeaderSize || ::memcmp(contents.data(), Capture::Magic, sizeof(Capture::Magic)) != 0)
+        {
+            return false;
+        }
+
+        ::memcpy(&version, contents.data() + 4, sizeof(version));
+        offset = Capture::HeaderSize;
+
+        return version == Capture::Version;
+    }
+
+    /**
+     * @return {bool} False at the end of the capture, or at a record cut short.
+     */
+    bool Next(Capture::Record& record)
+    {
+        if (offset + Capture::RecordSize > contents.size())
+        {
+            return false;
+        }
+
+        const uint8_t* at = contents.data() + offset;
+
+        ::memcpy(&record.time_us, at + 0, 8);
+        ::memcpy(&record.direction, at + 8, 1);
+        ::memcpy(&record.injected, at + 9, 1);
+        ::memcpy(&record.id, at + 10, 2);
+        ::memcpy(&record.size, at + 12, 2);
+
+        if (offset + Capture::RecordSize + record.size > contents.size())
+        {
+            return false;
+        }
+
+        record.data = at + Capture::RecordSize;
+        offset += Capture::RecordSize + record.size;
+
+        return true;
+    }
+
+    void Rewind()
+    {
+        offset = Capture::HeaderSize;
+    }
+};
+
+#endif // PACKET_CAPTURE_H_INCLUDED
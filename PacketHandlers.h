@@ -0,0 +1,133 @@
+#ifndef PACKET_HANDLERS_H_INCLUDED
+#define PACKET_HANDLERS_H_INCLUDED
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <cstdint>
+
+#include "EntityTracker.h"
+#include "PacketLayouts.h"
+#include "PacketRules.h"
+
+/**
+ * The packet handlers and their dispatch tables, over the state of whoever dispatches. The plugin (Packets.cpp), the
+ * replayer (tools/Replay.cpp), the allocation check (tools/AllocCheck.cpp) and the fuzzer (tools/PacketFuzz.cpp) all
+ * dispatch through these, so what they run is what the game runs.
+ *
+ * The context provides:
+ *
+ *  - int ClosestTarget(), int NextTarget(): the decided target and the one picked while fighting, -1 if none.
+ *  - uint32_t PlayerServerId(): the player's server id, 0 if not known yet.
+ *  - EntityTracker& Entities(): the entities of the current frame.
+ *  - void InvalidateTarget(int index, const char* source, const char* reason)
+ *  - void InvalidateNext(int index, const char* reason)
+ *  - void ObserveEngage(uint16_t index): the client turned a queued /attack into its engage packet.
+ */
+template <typename Context>
+void OnEntityUpdate(Context& context, const PacketView<EntityUpdate>& packet)
+{
+    const uint16_t index = packet.Get<EntityUpdate::Index>();
+    const int closest = context.ClosestTarget();
+
+    if (index != closest && index != context.NextTarget())
+    {
+        return;
+    }
+
+    const Invalidation reason = EntityUpdateInvalidation(packet, context.PlayerServerId());
+
+    if (reason == Invalidation::None)
+    {
+        return;
+    }
+
+    if (index == closest)
+    {
+        context.InvalidateTarget(index, "packet", InvalidationNames[size_t(reason)]);
+    }
+    else
+    {
+        context.InvalidateNext(index, InvalidationNames[size_t(reason)]);
+    }
+}
+
+template <typename Context>
+void OnActionMessage(Context& context, const PacketView<ActionMessage>& packet)
+{
+    const uint16_t index = packet.Get<ActionMessage::TargetIndex>();
+    const uint16_t actor = packet.Get<ActionMessage::ActorIndex>();
+    const int closest = context.ClosestTarget();
+
+    // A MOB ACTING ON US IS AGGRO BEFORE IT SHOWS UP AS A CLAIM
+    if (ActionMessageTargetsSelf(packet, context.PlayerServerId()) && actor < EntityTracker::Count)
+    {
+        EntityTracker& entities = context.Entities();
+        const EntityTracker::Entry& e = entities.Get(actor);
+
+        if (e.present && e.spawn_flags == 0x10 && e.hp > 0)
+        {
+            entities.SetAggro(actor, true);
+        }
+    }
+
+    if (index != closest && index != context.NextTarget())
+    {
+        return;
+    }
+
+    if (ActionMessageInvalidation(packet) != Invalidation::Defeated)
+    {
+        return;
+    }
+
+    if (index == closest)
+    {
+        context.InvalidateTarget(index, "packet", InvalidationNames[size_t(Invalidation::Defeated)]);
+    }
+    else
+    {
+        context.InvalidateNext(index, InvalidationNames[size_t(Invalidation::Defeated)]);
+    }
+}
+
+template <typename Context>
+void OnActionRequest(Context& context, const PacketView<ActionRequest>& packet)
+{
+    if (!ActionRequestEngages(packet))
+    {
+        return;
+    }
+
+    context.ObserveEngage(packet.Get<ActionRequest::TargetIndex>());
+}
+
+/**
+ * Incoming packet handlers, indexed by packet id at compile time.
+ */
+template <typename Context>
+inline constexpr auto IncomingPackets = []
+{
+    PacketDispatch<Context> dispatch;
+
+    dispatch.template On<EntityUpdate, &OnEntityUpdate<Context>>();
+    dispatch.template On<ActionMessage, &OnActionMessage<Context>>();
+
+    return dispatch;
+}();
+
+/**
+ * Outgoing packet handlers, indexed by packet id at compile time.
+ */
+template <typename Context>
+inline constexpr auto OutgoingPackets = []
+{
+    PacketDispatch<Context> dispatch;
+
+    dispatch.template On<ActionRequest, &OnActionRequest<Context>>();
+
+    return dispatch;
+}();
+
+#endif // PACKET_HANDLERS_H_INCLUDED
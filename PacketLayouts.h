@@ -0,0 +1,65 @@
+#ifndef PACKET_LAYOUTS_H_INCLUDED
+#define PACKET_LAYOUTS_H_INCLUDED
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include "PacketView.h"
+
+/**
+ * Incoming 0x00E, Entity Update.
+ *
+ * Mask: 0x01 = Position, 0x02 = Claimer ID, 0x04 = HP% / Status, 0x08 = Name, 0x20 = Despawn
+ */
+struct EntityUpdate
+{
+    static constexpr uint16_t Id = 0x00E;
+    static constexpr uint32_t Size = 0x30;
+
+    using ServerId = PacketField<uint32_t, 0x04>;
+    using Index = PacketField<uint16_t, 0x08>;
+    using Mask = PacketField<uint8_t, 0x0A>;
+    using HPPercent = PacketField<uint8_t, 0x1E>;
+    using Status = PacketField<uint8_t, 0x1F>;
+    using ClaimId = PacketField<uint32_t, 0x2C>;
+
+    static constexpr uint8_t MaskClaim = 0x02;
+    static constexpr uint8_t MaskStatus = 0x04;
+    static constexpr uint8_t MaskDespawn = 0x20;
+};
+
+/**
+ * Incoming 0x029, Action Message.
+ */
+struct ActionMessage
+{
+    static constexpr uint16_t Id = 0x029;
+    static constexpr uint32_t Size = 0x1A;
+
+    using ActorId = PacketField<uint32_t, 0x04>;
+    using TargetId = PacketField<uint32_t, 0x08>;
+    using Param1 = PacketField<uint32_t, 0x0C>;
+    using Param2 = PacketField<uint32_t, 0x10>;
+    using ActorIndex = PacketField<uint16_t, 0x14>;
+    using TargetIndex = PacketField<uint16_t, 0x16>;
+    using Message = PacketField<uint16_t, 0x18>;
+};
+
+/**
+ * Outgoing 0x01A, Action.
+ *
+ * Category: 0x02 = Engage, 0x04 = Disengage
+ */
+struct ActionRequest
+{
+    static constexpr uint16_t Id = 0x01A;
+    static constexpr uint32_t Size = 0x1C;
+
+    using TargetId = PacketField<uint32_t, 0x04>;
+    using TargetIndex = PacketField<uint16_t, 0x08>;
+    using Category = PacketField<uint16_t, 0x0A>;
+    using Param = PacketField<uint16_t, 0x0C>;
+};
+
+#endif // PACKET_LAYOUTS_H_INCLUDED
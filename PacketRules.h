@@ -0,0 +1,109 @@
+#ifndef PACKET_RULES_H_INCLUDED
+#define PACKET_RULES_H_INCLUDED
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <cstdint>
+
+#include "PacketLayouts.h"
+
+/**
+ * What the packet handlers read out of a packet, without any game state. The plugin's handlers and the offline
+ * replayer (tools/Replay.cpp) both decide through these, so a capture replays the same rules the game ran.
+ */
+enum class Invalidation : uint8_t
+{
+    None,
+    Despawn,
+    Death,
+    Claimed,
+    Defeated,
+    Count,
+};
+
+inline constexpr const char* InvalidationNames[size_t(Invalidation::Count)] =
+{
+    "none",
+    "despawn",
+    "death",
+    "claimed",
+    "defeated",
+};
+
+/**
+ * @param {uint32_t} self - The player's server id, a claim by the player does not invalidate.
+ * @return {Invalidation} Why the entity the update is about stops being a target, None if it does not.
+ */
+inline Invalidation EntityUpdateInvalidation(const PacketView<EntityUpdate>& packet, uint32_t self)
+{
+    const uint8_t mask = packet.Get<EntityUpdate::Mask>();
+
+    if (mask & EntityUpdate::MaskDespawn)
+    {
+        return Invalidation::Despawn;
+    }
+
+    if (mask & EntityUpdate::MaskStatus)
+    {
+        const uint8_t hp = packet.Get<EntityUpdate::HPPercent>();
+        const uint8_t status = packet.Get<EntityUpdate::Status>();
+
+        if (hp == 0 || status == 2 || status == 3)
+        {
+            return Invalidation::Death;
+        }
+    }
+
+    if (mask & EntityUpdate::MaskClaim)
+    {
+        const uint32_t claimer = packet.Get<EntityUpdate::ClaimId>();
+
+        if (claimer != 0 && claimer != self)
+        {
+            return Invalidation::Claimed;
+        }
+    }
+
+    return Invalidation::None;
+}
+
+/**
+ * @return {Invalidation} Defeated if the message says the target was defeated, None otherwise.
+ */
+inline Invalidation ActionMessageInvalidation(const PacketView<ActionMessage>& packet)
+{
+    // DEFEATS, FALLS TO THE GROUND, WAS DEFEATED BY
+    switch (packet.Get<ActionMessage::Message>())
+    {
+    case 6:
+    case 20:
+    case 97:
+    case 113:
+    case 406:
+    case 605:
+    case 646:
+        return Invalidation::Defeated;
+    default:
+        return Invalidation::None;
+    }
+}
+
+/**
+ * @return {bool} True if the actor of the message acted on the player.
+ */
+inline bool ActionMessageTargetsSelf(const PacketView<ActionMessage>& packet, uint32_t self)
+{
+    return self != 0 && packet.Get<ActionMessage::TargetId>() == self;
+}
+
+/**
+ * @return {bool} True if the request engages its target.
+ */
+inline bool ActionRequestEngages(const PacketView<ActionRequest>& packet)
+{
+    return packet.Get<ActionRequest::Category>() == 0x02;
+}
+
+#endif // PACKET_RULES_H_INCLUDED
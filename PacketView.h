@@ -0,0 +1,181 @@
+#ifndef PACKET_VIEW_H_INCLUDED
+#define PACKET_VIEW_H_INCLUDED
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+/**
+ * Compile-time packet layouts and zero-copy views over raw packet buffers.
+ *
+ * A layout is a struct with an Id, a minimum Size and its fields declared as types:
+ *
+ *      struct EntityUpdate
+ *      {
+ *          static constexpr uint16_t Id = 0x00E;
+ *          static constexpr uint32_t Size = 0x30;
+ *
+ *          using Index = PacketField<uint16_t, 0x08>;
+ *          using Mask = PacketBits<uint8_t, 0x0A, 0, 8>;
+ *      };
+ *
+ * PacketView<Layout>::From checks the buffer size once, after which every Get is an unchecked, unaligned safe read
+ * straight out of the buffer. Fields that do not fit in the layout's Size fail to compile.
+ */
+template <typename T, uint32_t Offset>
+struct PacketField
+{
+    static_assert(std::is_trivially_copyable_v<T>, "Packet fields must be trivially copyable.");
+
+    using Type = T;
+    static constexpr uint32_t End = Offset + sizeof(T);
+
+    static T Read(const uint8_t* data)
+    {
+        T value;
+        ::memcpy(&value, data + Offset, sizeof(T));
+        return value;
+    }
+
+    static void Write(uint8_t* data, T value)
+    {
+        ::memcpy(data + Offset, &value, sizeof(T));
+    }
+};
+
+template <typename T, uint32_t Offset, uint32_t Shift, uint32_t Width>
+struct PacketBits
+{
+    static_assert(std::is_unsigned_v<T> && Shift + Width <= sizeof(T) * 8, "Packet bits must fit in their storage.");
+
+    using Type = T;
+    static constexpr uint32_t End = Offset + sizeof(T);
+    static constexpr T Mask = T((uint64_t(1) << Width) - 1);
+
+    static T Read(const uint8_t* data)
+    {
+        return T(PacketField<T, Offset>::Read(data) >> Shift) & Mask;
+    }
+
+    static void Write(uint8_t* data, T value)
+    {
+        const T word = PacketField<T, Offset>::Read(data);
+        PacketField<T, Offset>::Write(data, T((word & ~T(Mask << Shift)) | T((value & Mask) << Shift)));
+    }
+};
+
+/**
+ * Every packet starts with the same header: id (9 bits), size in 4 byte words (7 bits) and the sync counter.
+ */
+struct PacketHeader
+{
+    static constexpr uint32_t Size = 0x04;
+
+    using Id = PacketBits<uint16_t, 0x00, 0, 9>;
+    using Words = PacketBits<uint16_t, 0x00, 9, 7>;
+    using Sync = PacketField<uint16_t, 0x02>;
+};
+
+template <typename Layout>
+class PacketView final
+{
+    const uint8_t* data;
+
+    explicit PacketView(const uint8_t* _data)
+        : data(_data)
+    {}
+
+public:
+    /**
+     * The only bounds check. Returns false (and leaves view untouched) if the buffer is too small for the layout.
+     */
+    static bool From(const uint8_t* data, uint32_t size, PacketView& view)
+    {
+        if (data == nullptr || size < Layout::Size)
+        {
+            return false;
+        }
+
+        view.data = data;
+        return true;
+    }
+
+    PacketView(void)
+        : data(nullptr)
+    {}
+
+    template <typename Field>
+    typename Field::Type Get() const
+    {
+        static_assert(Field::End <= Layout::Size, "Field lies outside of the packet layout.");
+        return Field::Read(data);
+    }
+
+    const uint8_t* Data() const
+    {
+        return data;
+    }
+};
+
+/**
+ * Writes a field into an outgoing packet buffer of at least Layout::Size bytes.
+ */
+template <typename Layout, typename Field>
+void PacketWrite(uint8_t* data, typename Field::Type value)
+{
+    static_assert(Field::End <= Layout::Size, "Field lies outside of the packet layout.");
+    Field::Write(data, value);
+}
+
+/**
+ * Dispatch table indexed by packet id, built at compile time.
+ *
+ * Handler is the function invoked with the context and a checked view. Entries without a handler are nullptr.
+ */
+template <typename Context>
+class PacketDispatch final
+{
+public:
+    using Entry = void (*)(Context&, const uint8_t*, uint32_t);
+
+private:
+    template <typename Layout, void (*Handler)(Context&, const PacketView<Layout>&)>
+    static void Invoke(Context& context, const uint8_t* data, uint32_t size)
+    {
+        PacketView<Layout> view;
+
+        if (PacketView<Layout>::From(data, size, view))
+        {
+            Handler(context, view);
+        }
+    }
+
+public:
+    std::array<Entry, 0x200> entries{};
+
+    template <typename Layout, void (*Handler)(Context&, const PacketView<Layout>&)>
+    constexpr PacketDispatch& On()
+    {
+        static_assert(Layout::Id < 0x200, "Packet ids are 9 bits.");
+        entries[Layout::Id] = &Invoke<Layout, Handler>;
+        return *this;
+    }
+
+    bool operator()(Context& context, uint16_t id, const uint8_t* data, uint32_t size) const
+    {
+        if (id >= entries.size() || entries[id] == nullptr)
+        {
+            return false;
+        }
+
+        entries[id](context, data, size);
+        return true;
+    }
+};
+
+#endif // PACKET_VIEW_H_INCLUDED
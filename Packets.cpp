@@ -0,0 +1,143 @@
+#ifndef PACKETS_H_INCLUDED
+#define PACKETS_H_INCLUDED
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include "PacketHandlers.h"
+#include "Stockpile.h"
+#include "Zones.h"
+
+bool Stockpile::DispatchIncomingPacket(uint16_t id, uint32_t size, const uint8_t* data)
+{
+    return IncomingPackets<Stockpile>(*this, id, data, size);
+}
+
+bool Stockpile::DispatchOutgoingPacket(uint16_t id, uint32_t size, const uint8_t* data)
+{
+    return OutgoingPackets<Stockpile>(*this, id, data, size);
+}
+
+/**
+ * The context of the packet handlers, see PacketHandlers.h. (Render thread, packets arrive between frames.)
+ */
+int Stockpile::ClosestTarget() const
+{
+    return decided.closest_target_id;
+}
+
+int Stockpile::NextTarget() const
+{
+    return decided.next_target_id;
+}
+
+uint32_t Stockpile::PlayerServerId() const
+{
+    return player_server_id;
+}
+
+EntityTracker& Stockpile::Entities()
+{
+    return entities;
+}
+
+/**
+ * The client turned a queued /attack into its engage packet, the command queue and chat parsing are done.
+ */
+void Stockpile::ObserveEngage(uint16_t index)
+{
+    metrics.Reactions().Observe(Reaction::CommandToPacket, Milliseconds(), [index](const ReactionTracer::Pending& p) { return p.target == index; });
+}
+
+/**
+ * Drops a target the moment a packet shows it dead, despawned or claimed by someone else instead of waiting for the
+ * next frame to poll the entity.
+ *
+ * A snapshot carrying the invalidated handle is published right away, so the worker decides the next target while
+ * the frame is still to come and the decision is applied at its start. Polled, the death would only reach the worker
+ * with the snapshot published at the end of that frame, and be applied a frame later.
+ *
+ * The chat drops targets through here too, once the frame confirms what the line said. (ApplyChatEvents)
+ */
+void Stockpile::InvalidateTarget(int index, const char* source, const char* reason)
+{
+    Log(tick_arena.Format("Target {} invalidated by {}. ({})", index, source, reason));
+
+    claims.Release(zone_id, index);
+
+    invalidated_handle = entities.MakeHandle(index);
+
+    // NOT A CANDIDATE UNTIL THE SNAPSHOT CATCHES UP
+    entities.Mark(index, false);
+    entities.SetAggro(index, false);
+
+    decided.closest_target_id = -1;
+
+    PublishInvalidation(index);
+}
+
+/**
+ * The same for the target picked while fighting, so the worker does not take a dead or stolen mob as the next one.
+ * Nothing was reserved for it, so there is no claim to release.
+ */
+void Stockpile::InvalidateNext(int index, const char* reason)
+{
+    Log(tick_arena.Format("Next target {} invalidated by packet. ({})", index, reason));
+
+    invalidated_next_handle = entities.MakeHandle(index);
+
+    entities.Mark(index, false);
+    entities.SetAggro(index, false);
+
+    decided.next_target_id = -1;
+
+    PublishInvalidation(index);
+}
+
+/**
+ * Wakes the worker on an invalidation, and traces it until the decision made from it is applied. (ApplyDecisions)
+ */
+void Stockpile::PublishInvalidation(int index)
+{
+    if (!running)
+    {
+        return;
+    }
+
+    PublishSnapshot();
+
+    invalidated_sequence = snapshot_sequence;
+    metrics.Reactions().Emit(Reaction::Retarget, Milliseconds(), index);
+}
+
+/**
+ * Records every packet in and out to config/stockpile/captures/capture_<time>.spcap, for tools/Replay.cpp.
+ */
+void Stockpile::CaptureStart()
+{
+    const std::filesystem::path directory = std::filesystem::path(m_AshitaCore->GetInstallPath()) / "config" / "stockpile" / "captures";
+
+    std::error_code error;
+    std::filesystem::create_directories(directory, error);
+
+    const std::filesystem::path file = directory / std::format("capture_{}.spcap", uint64_t(std::time(nullptr)));
+
+    if (capture.Open(file.string().c_str()))
+    {
+        Log(std::format("Capturing: {}", file.string()));
+    }
+    else
+    {
+        Log(std::format("Capture failed: {}", file.string()));
+    }
+}
+
+void Stockpile::CaptureStop()
+{
+    capture.Close();
+
+    Log(std::format("Captured {} packets.", capture.Records()));
+}
+
+#endif // PACKETS_H_INCLUDED
@@ -0,0 +1,161 @@
+#ifndef REACTION_TRACER_H_INCLUDED
+#define REACTION_TRACER_H_INCLUDED
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <array>
+#include <cstdint>
+
+#include "Histogram.h"
+
+/**
+ * What the bot did, and the effect that shows the game reacted to it.
+ */
+enum class Reaction : uint8_t
+{
+    Decide,             // Snapshot published -> decision applied. (Worker pipeline.)
+    Retarget,           // Target invalidated -> the decision made from it is applied. (Worker pipeline.)
+    Select,             // SetTarget -> the target is selected.
+    EngagePacket,       // Engage packet injected -> locked on. (Server.)
+    EngageCommand,      // /attack queued -> locked on. (Command queue, chat parsing and server.)
+    CommandToPacket,    // /attack queued -> its 0x01A leaves the client. (Command queue and chat parsing.)
+    Turn,               // Turn key down -> the heading changes.
+    Move,               // Forward / backward key down -> the position changes.
+    Count,
+};
+
+inline constexpr const char* ReactionNames[size_t(Reaction::Count)] =
+{
+    "Decide",
+    "Retarget",
+    "Select",
+    "Engage (Packet)",
+    "Engage (Command)",
+    "Command to Packet",
+    "Turn",
+    "Move",
+};
+
+/**
+ * ReactionTracer Class Implementation
+ *
+ * Tags every emitted action with a sequence id and the time it was emitted, and correlates it with the first frame
+ * (or packet) that shows its effect. The latency lands in a histogram per reaction, actions whose effect is never
+ * seen within Timeout are counted as missed instead.
+ *
+ * Pending actions live in a fixed ring, an action still pending when its slot comes around again is missed. A repeat
+ * of an action that is still pending for the same target keeps the first one, the latency runs from the first try.
+ */
+class ReactionTracer final
+{
+public:
+    static constexpr uint32_t Slots = 32;
+    static constexpr uint64_t Timeout = 5000;
+
+    struct Pending
+    {
+        uint32_t sequence;
+        uint64_t sent_ms;
+        int32_t target;             // Entity index the action is aimed at, -1 for none.
+        float x;                    // Player position and heading when it was emitted, for Turn and Move.
+        float y;
+        float heading;
+        Reaction reaction;
+        bool open;
+    };
+
+private:
+    std::array<Pending, Slots> pending{};
+    uint32_t sequence;
+    std::array<Histogram, size_t(Reaction::Count)> latency{};
+    std::array<uint32_t, size_t(Reaction::Count)> emitted{};
+    std::array<uint32_t, size_t(Reaction::Count)> missed{};
+
+public:
+    ReactionTracer(void)
+        : sequence(0)
+    {}
+    ~ReactionTracer(void) {}
+
+    /**
+     * @return {uint32_t} The action's sequence id, or the pending one's if it repeats it.
+     */
+    uint32_t Emit(Reaction reaction, uint64_t now, int32_t target = -1, float x = 0, float y = 0, float heading = 0)
+    {
+        for (const Pending& p : pending)
+        {
+            if (p.open && p.reaction == reaction && p.target == target)
+            {
+                return p.sequence;
+            }
+        }
+
+        Pending& p = pending[++sequence % Slots];
+
+        if (p.open)
+        {
+            missed[size_t(p.reaction)]++;
+        }
+
+        p = Pending{ sequence, now, target, x, y, heading, reaction, true };
+        emitted[size_t(reaction)]++;
+
+        return sequence;
+    }
+
+    /**
+     * Closes every pending action of the reaction that seen(pending) says took effect.
+     */
+    template <typename F>
+    void Observe(Reaction reaction, uint64_t now, F&& seen)
+    {
+        for (Pending& p : pending)
+        {
+            if (p.open && p.reaction == reaction && seen(static_cast<const Pending&>(p)))
+            {
+                latency[size_t(reaction)].Add(now > p.sent_ms ? now - p.sent_ms : 0);
+                p.open = false;
+            }
+        }
+    }
+
+    /**
+     * Records a latency measured elsewhere. (ie. Decide, whose start and end are both known when it is applied.)
+     */
+    void Add(Reaction reaction, uint64_t ms)
+    {
+        emitted[size_t(reaction)]++;
+        latency[size_t(reaction)].Add(ms);
+    }
+
+    void Expire(uint64_t now)
+    {
+        for (Pending& p : pending)
+        {
+            if (p.open && now > p.sent_ms + Timeout)
+            {
+                missed[size_t(p.reaction)]++;
+                p.open = false;
+            }
+        }
+    }
+
+    /**
+     * Stops waiting on everything pending, without counting it. (The bot stopped, the effects will never come.)
+     */
+    void Abandon()
+    {
+        for (Pending& p : pending)
+        {
+            p.open = false;
+        }
+    }
+
+    const Histogram& Latency(Reaction reaction) const { return latency[size_t(reaction)]; }
+    uint32_t Emitted(Reaction reaction) const { return emitted[size_t(reaction)]; }
+    uint32_t Missed(Reaction reaction) const { return missed[size_t(reaction)]; }
+};
+
+#endif // REACTION_TRACER_H_INCLUDED
@@ -0,0 +1,80 @@
+#ifndef SPSC_QUEUE_H_INCLUDED
+#define SPSC_QUEUE_H_INCLUDED
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+/**
+ * SpscQueue Class Implementation
+ *
+ * Bounded single producer, single consumer ring. Push never blocks, it fails when the ring is full and the caller
+ * decides what to drop. The head and tail live on separate cache lines so the two threads do not false share.
+ */
+template <typename T, uint32_t Capacity>
+class SpscQueue final
+{
+    static_assert(Capacity != 0 && (Capacity & (Capacity - 1)) == 0, "SpscQueue capacity must be a power of two.");
+
+    std::array<T, Capacity> items{};
+    alignas(64) std::atomic<uint32_t> head;     // Consumer.
+    alignas(64) std::atomic<uint32_t> tail;     // Producer.
+
+public:
+    SpscQueue(void)
+        : head(0)
+        , tail(0)
+    {}
+    ~SpscQueue(void) {}
+
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    /**
+     * Producer only.
+     *
+     * @return {bool} True if the item was queued, false if the queue is full.
+     */
+    bool Push(const T& item)
+    {
+        const uint32_t t = tail.load(std::memory_order_relaxed);
+
+        if (t - head.load(std::memory_order_acquire) == Capacity)
+        {
+            return false;
+        }
+
+        items[t & (Capacity - 1)] = item;
+        tail.store(t + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    /**
+     * Consumer only. Invokes f(item) for every queued item, oldest first.
+     *
+     * @return {uint32_t} The number of items drained.
+     */
+    template <typename F>
+    uint32_t Drain(F&& f)
+    {
+        uint32_t h = head.load(std::memory_order_relaxed);
+        const uint32_t t = tail.load(std::memory_order_acquire);
+        const uint32_t count = t - h;
+
+        for (; h != t; h++)
+        {
+            f(items[h & (Capacity - 1)]);
+        }
+
+        head.store(h, std::memory_order_release);
+
+        return count;
+    }
+};
+
+#endif // SPSC_QUEUE_H_INCLUDED
@@ -0,0 +1,323 @@
+#ifndef STATES_H_INCLUDED
+#define STATES_H_INCLUDED
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include "Stockpile.h"
+#include "Zones.h"
+
+/**
+ * One tick per BotState, in BotState order. Each returns the state to be in after it, if that is another state the
+ * tick has left the decision alone and the next state's tick runs on the same decision.
+ */
+const Stockpile::StateTick Stockpile::state_ticks[size_t(BotState::Count)] =
+{
+    &Stockpile::TickIdle,
+    &Stockpile::TickPatrol,
+    &Stockpile::TickAcquire,
+    &Stockpile::TickApproach,
+    &Stockpile::TickEngage,
+    &Stockpile::TickFight,
+    &Stockpile::TickRecover,
+};
+
+void Stockpile::Enter(BotState state)
+{
+    if (state == BotState::Idle)
+    {
+        ResetDecisions();
+    }
+
+    bot_state = state;
+}
+
+BotState Stockpile::TickIdle(const Snapshot& s, Decision& decision)
+{
+    UNREFERENCED_PARAMETER(decision);
+
+    return s.running ? BotState::Acquire : BotState::Idle;
+}
+
+/**
+ * Switches to the target picked during the last fight, then to the closest mob already attacking the player, and
+ * only scans for a new pull when neither is left. Runs in the same decision the last target was dropped in, so the
+ * switch and the first turn towards the next target happen on the tick the kill is seen.
+ */
+BotState Stockpile::TickAcquire(const Snapshot& s, Decision& decision)
+{
+    UNREFERENCED_PARAMETER(decision);
+
+    return AcquireNext(s) || AcquireAggro(s) || AcquireTarget(s) ? BotState::Approach : BotState::Patrol;
+}
+
+/**
+ * Walks the path back and forth, steering at a pure pursuit point ahead, until a target comes into range.
+ */
+BotState Stockpile::TickPatrol(const Snapshot& s, Decision& decision)
+{
+    if (AcquireAggro(s) || AcquireTarget(s))
+    {
+        return BotState::Approach;
+    }
+
+    const std::vector<Pos>& path = *s.path;
+
+    // NOT ON THE PATH YET, START FROM THE CLOSEST NODE
+    if (closest_path_id == -1)
+    {
+        float distance_pos = FLT_MAX;
+
+        for (int n = 0; n < int(path.size()); n++)
+        {
+            if (distance(path[n], s.player) < distance_pos)
+            {
+                distance_pos = distance(path[n], s.player);
+                closest_path_id = n;
+            }
+        }
+
+        return BotState::Patrol;
+    }
+
+    // PURE PURSUIT DOWN THE PATH, AROUND OBSTACLES
+    Pos pos = Navigate(s, PursuitPoint(s, path));
+
+    float heading_difference = GetHeadingDifference(s, pos.x, pos.y);
+
+    int32_t turn = steering.Turn(heading_difference, distance(s.player, pos), s.player_heading, s.settings.tolerance_yaw * 2, s.tick_ms);
+
+    if (turn < 0)
+    {
+        decision.keys |= KeyRight;
+    }
+    if (turn > 0)
+    {
+        decision.keys |= KeyLeft;
+    }
+
+    decision.keys |= KeyForward;
+
+    if (sqrt(distance(path[closest_path_id], s.player)) < s.settings.range_next_path)
+    {
+        if (reverse_path)
+        {
+            if (closest_path_id == int(path.size() - 1))
+            {
+                reverse_path = false;
+            }
+            else
+            {
+                closest_path_id++;
+            }
+        }
+        else
+        {
+            if (closest_path_id == 0)
+            {
+                reverse_path = true;
+            }
+            else
+            {
+                closest_path_id--;
+            }
+        }
+    }
+
+    return BotState::Patrol;
+}
+
+/**
+ * Closes to engage range, steering around obstacles.
+ */
+BotState Stockpile::TickApproach(const Snapshot& s, Decision& decision)
+{
+    Engagement t{};
+
+    if (!TrackTarget(s, decision, t))
+    {
+        return BotState::Acquire;
+    }
+
+    if (s.has_lock)
+    {
+        return BotState::Fight;
+    }
+
+    if (t.distance < s.settings.range_engage)
+    {
+        return BotState::Engage;
+    }
+
+    // MOVE LEFT OR RIGHT, AROUND OBSTACLES UNTIL IN RANGE
+    Pos steer = Navigate(s, Pos{ t.entry->x, t.entry->y, t.entry->z });
+
+    float steer_difference = GetHeadingDifference(s, steer.x, steer.y);
+
+    int32_t turn = steering.Turn(steer_difference, distance(s.player, steer), s.player_heading, s.settings.tolerance_yaw, s.tick_ms);
+
+    if (turn < 0)
+    {
+        decision.keys |= KeyRight;
+    }
+    if (turn > 0)
+    {
+        decision.keys |= KeyLeft;
+    }
+
+    // KEEP THE APPROACH BAND CURRENT, OUTSIDE ENGAGE RANGE IT ALWAYS SAYS GO
+    steering.Approach(t.distance, s.settings.range_attacking);
+
+    decision.keys |= KeyForward;
+
+    return BotState::Approach;
+}
+
+/**
+ * In engage range: selects the target once it settled and attacks until the lock comes on.
+ */
+BotState Stockpile::TickEngage(const Snapshot& s, Decision& decision)
+{
+    Engagement t{};
+
+    if (!TrackTarget(s, decision, t))
+    {
+        return BotState::Acquire;
+    }
+
+    if (s.has_lock)
+    {
+        return BotState::Fight;
+    }
+
+    if (t.distance >= s.settings.range_engage)
+    {
+        return BotState::Approach;
+    }
+
+    steering.Idle(s.tick_ms);
+
+    // SELECT TARGET, OR RESELECT IT IF SOMETHING ELSE (ie. THE PLAYER) IS SELECTED
+    const bool selected = s.has_target && s.targeted_id == closest_target_id;
+
+    if (select_ready && ((target_settled && t.distance >= s.settings.range_attacking) || (s.has_target && !selected)))
+    {
+        decision.select_id = closest_target_id;
+        select_ready = false;
+        timers.Schedule(TimerSelectReady, 3000);
+    }
+
+    // ATTACK TARGET, ONLY ONCE IT IS THE ONE SELECTED
+    if (selected && attack_ready)
+    {
+        decision.engage_id = closest_target_id;
+        attack_ready = false;
+        timers.Schedule(TimerAttackReady, 3000);
+    }
+
+    // KEEP APPROACHING UNTIL A LITTLE INSIDE RANGE, SO SMALL MOVES DO NOT TOGGLE THE KEY
+    if (steering.Approach(t.distance, s.settings.range_attacking) || target_moving || (close_in && t.distance > s.settings.range_minimum))
+    {
+        decision.keys |= KeyForward;
+    }
+
+    return BotState::Engage;
+}
+
+/**
+ * Locked on, the game faces the target. Holds attack range, backing off when too close or not facing it.
+ */
+BotState Stockpile::TickFight(const Snapshot& s, Decision& decision)
+{
+    Engagement t{};
+
+    if (!TrackTarget(s, decision, t))
+    {
+        return BotState::Acquire;
+    }
+
+    if (!s.has_lock)
+    {
+        return t.distance < s.settings.range_engage ? BotState::Engage : BotState::Approach;
+    }
+
+    steering.Idle(s.tick_ms);
+
+    // PICK THE NEXT TARGET WHILE THIS ONE DIES
+    PlanNext(s);
+
+    bool facing = abs(t.heading_difference) < s.settings.tolerance_yaw;
+
+    // MOVE FORWARD OR BACKWARDS
+    if (steering.Approach(t.distance, s.settings.range_attacking) || target_moving || (close_in && t.distance > s.settings.range_minimum))
+    {
+        decision.keys |= KeyForward;
+    }
+    else if (s.has_target && (t.distance < s.settings.range_minimum || !facing))
+    {
+        decision.keys |= KeyBackward;
+    }
+
+    return BotState::Fight;
+}
+
+/**
+ * Dead, nothing to do until raised. Picks the old target back up if it is still valid.
+ */
+BotState Stockpile::TickRecover(const Snapshot& s, Decision& decision)
+{
+    UNREFERENCED_PARAMETER(decision);
+
+    if (s.is_player_dead)
+    {
+        return BotState::Recover;
+    }
+
+    return closest_target_id != -1 ? BotState::Approach : BotState::Acquire;
+}
+
+/**
+ * Checks the closest target is still worth chasing and keeps its claim, for every state that has one.
+ *
+ * @return {bool} True if the target is still valid, false if it was dropped.
+ */
+bool Stockpile::TrackTarget(const Snapshot& s, Decision& decision, Engagement& t)
+{
+    const EntityTracker::Entry& e = s.entities.Get(closest_target_id);
+
+    target_moving = s.entities.Changes(closest_target_id) & EntityTracker::Moved;
+
+    t.entry = &e;
+    t.distance = distance(s.player, Pos{ e.x, e.y, e.z });
+    t.heading_difference = GetHeadingDifference(s, e.x, e.y);
+
+    decision.closest_target_distance = t.distance;
+
+    // CLAIMED
+    bool claimed = e.claim_id == s.player_server_id || e.claim_id == 0;
+
+    // UNLOCK SELF & UNLOCK CLAIMS
+    if (s.has_target && s.targeted_id == s.player_id && !escape_down)
+    {
+        decision.commands |= CommandEscapeDown;
+        escape_down = true;
+        timers.Schedule(TimerEscapeRelease, RandomA(100));
+    }
+
+    // PUBLISH INTENT / CLAIM, A SIBLING THAT GOT THERE FIRST KEEPS IT
+    bool reserved = claims.Reserve(s.zone_id, closest_target_id, s.has_lock || e.claim_id == s.player_server_id ? ClaimTable::Claim : ClaimTable::Intent, s.tick_ms);
+
+    // GET NEW CLOSEST TARGET (STALE = DESPAWNED OR SLOT REUSED BY ANOTHER MOB)
+    if (s.entities.IsStale(closest_target_handle) || t.distance >= s.settings.range_new_target || !claimed || (!reserved && !s.has_lock) || e.hp == 0 || !e.present || e.status == 2 || e.status == 3)
+    {
+        claims.Release(s.zone_id, closest_target_id);
+        closest_target_id = -1;
+
+        return false;
+    }
+
+    return true;
+}
+
+#endif // STATES_H_INCLUDED
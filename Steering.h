@@ -0,0 +1,161 @@
+#ifndef STEERING_H_INCLUDED
+#define STEERING_H_INCLUDED
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+/**
+ * Steering Class Implementation
+ *
+ * Turns and approaches with as few key presses as possible. Every press and release is a /sendkey round trip, so
+ * each turn should be one press of the right length instead of a burst of corrections.
+ *
+ *  - Dead band: no turn is started while the heading error is within tolerance, or within the angle a lateral
+ *    miss of ArrivalRadius makes at the current distance. (Close goals tolerate a larger angle.)
+ *  - Prediction: a key acts Lead milliseconds after it is decided, so the heading keeps changing for that long
+ *    after a release. The key is released as soon as the turn already in flight covers the remaining error,
+ *    using the turn rate measured while keys were held.
+ *  - Hysteresis: after a release the next press waits MinRest, long enough to see where the last one landed,
+ *    unless the error is well outside the dead band. An overshoot inside the dead band is left alone.
+ *
+ * Approach applies the same idea to the forward key with a distance band around the stop range.
+ */
+class Steering final
+{
+public:
+    static constexpr uint64_t Lead = 120;           // Milliseconds from deciding a key to the game acting on it.
+    static constexpr uint64_t MinRest = 150;        // Shortest pause between turn presses.
+    static constexpr float DefaultRate = 0.003f;    // Turn rate until one is measured, radians per millisecond.
+    static constexpr float ArrivalRadius = 1.5f;    // Lateral miss accepted at the goal, yalms.
+    static constexpr float Band = 0.25f;            // Approach hysteresis either side of the stop range, yalms.
+
+private:
+    int32_t turning;                    // 1 left, -1 right, 0 straight. (Sign of the heading difference.)
+    uint64_t changed_ms;
+    float rate;                         // Measured turn rate, radians per millisecond.
+    float last_heading;
+    uint64_t last_ms;
+    bool approaching;
+
+public:
+    Steering(void)
+        : turning(0)
+        , changed_ms(0)
+        , rate(DefaultRate)
+        , last_heading(0)
+        , last_ms(0)
+        , approaching(false)
+    {}
+    ~Steering(void) {}
+
+    /**
+     * @param {float} heading_difference - Signed angle to the steer point, positive is to the left.
+     * @param {float} distance - Distance to the steer point.
+     * @param {float} heading - The player's heading, to measure the turn rate.
+     * @param {float} tolerance - The dead band, radians.
+     * @param {uint64_t} now - The current time in milliseconds.
+     * @return {int32_t} 1 to turn left, -1 to turn right, 0 to go straight.
+     */
+    int32_t Turn(float heading_difference, float distance, float heading, float tolerance, uint64_t now)
+    {
+        // MEASURE HOW FAST A HELD KEY TURNS, ONCE THE PRESS HAS REACHED THE GAME
+        if (turning != 0 && last_ms != 0 && now > last_ms && last_ms >= changed_ms + Lead)
+        {
+            const float measured = std::abs(Wrap(heading - last_heading)) / float(now - last_ms);
+
+            rate = rate * 0.8f + measured * 0.2f;
+        }
+
+        last_heading = heading;
+        last_ms = now;
+
+        const float enter = std::max(tolerance, std::atan2(ArrivalRadius, std::max(distance, 0.1f)));
+        const float error = std::abs(heading_difference);
+        const int32_t side = heading_difference > 0 ? 1 : -1;
+
+        int32_t want = turning;
+
+        if (turning == 0)
+        {
+            if (error > enter && (now >= changed_ms + MinRest || error > enter * 2))
+            {
+                want = side;
+            }
+        }
+        else if (side != turning)
+        {
+            // ALREADY PAST IT
+            want = 0;
+        }
+        else if (error <= rate * float(std::min(Lead, now - changed_ms)))
+        {
+            // WHAT IS STILL IN FLIGHT FINISHES THE TURN
+            want = 0;
+        }
+
+        if (want != turning)
+        {
+            turning = want;
+            changed_ms = now;
+        }
+
+        return turning;
+    }
+
+    /**
+     * Not steering this decision. (ie. Locked on, the game faces the target.)
+     */
+    void Idle(uint64_t now)
+    {
+        if (turning != 0)
+        {
+            turning = 0;
+            changed_ms = now;
+        }
+
+        last_ms = 0;
+    }
+
+    /**
+     * @return {bool} True to hold the forward key, keeps going until Band inside range and restarts Band outside it.
+     */
+    bool Approach(float distance, float range)
+    {
+        approaching = approaching ? distance >= range - Band : distance >= range + Band;
+
+        return approaching;
+    }
+
+    void Reset()
+    {
+        turning = 0;
+        changed_ms = 0;
+        last_ms = 0;
+        approaching = false;
+    }
+
+private:
+    static float Wrap(float angle)
+    {
+        const float pi = 3.14159265f;
+
+        while (angle > pi)
+        {
+            angle -= 2 * pi;
+        }
+
+        while (angle < -pi)
+        {
+            angle += 2 * pi;
+        }
+
+        return angle;
+    }
+};
+
+#endif // STEERING_H_INCLUDED
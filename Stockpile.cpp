@@ -1,1122 +1,1585 @@
-#ifndef SOCKPILE_H_INCLUDED
-#define SOCKPILE_H_INCLUDED
-
-#if defined(_MSC_VER) && (_MSC_VER >= 1020)
-#pragma once
-#endif
-
-#define _USE_MATH_DEFINES
-
-#include "Stockpile.h"
-#include "Zones.h"
-
-/**
- * Constructor and Deconstructor
- */
-Stockpile::Stockpile(void)
-    : m_AshitaCore(nullptr)
-    , m_LogManager(nullptr)
-    , m_Direct3DDevice(nullptr)
-    , m_PluginId(0)
-{}
-Stockpile::~Stockpile(void)
-{}
-
-/**
- * Returns the plugins name.
- *
- * @return {const char*} The plugins name.
- */
-const char* Stockpile::GetName(void) const
-{
-    return "Stockpile";
-}
-
-/**
- * Returns the plugins author.
- *
- * @return {const char*} The plugins author.
- */
-const char* Stockpile::GetAuthor(void) const
-{
-    return "Fentus";
-}
-
-/**
- * Returns the plugins description.
- *
- * @return {const char*} The plugins description.
- */
-const char* Stockpile::GetDescription(void) const
-{
-    return "Combat Bot";
-}
-
-/**
- * returns the plugins homepage link.
- *
- * @return {const char*} The plugins homepage link.
- */
-const char* Stockpile::GetLink(void) const
-{
-    return "https://fentusgames.com/";
-}
-
-/**
- * Returns the plugins version.
- *
- * @return {double} The plugins version.
- */
-double Stockpile::GetVersion(void) const
-{
-    return 1;
-}
-
-/**
- * Returns the plugins Ashita interface version it was compiled against.
- *
- * @return {double} The plugins interface version.
- */
-double Stockpile::GetInterfaceVersion(void) const
-{
-    return ASHITA_INTERFACE_VERSION;
-}
-
-/**
- * Returns the plugins execution priority.
- *
- * @return {int32_t} The plugins execution priority.
- * @notes
- *
- *      The priority value is used to determine the execution order of the plugins loaded in Ashita. When an event is fired, Ashita
- *      will loop through each of the loaded plugins and allow them to attempt to handle the event. The order that the plugins are
- *      passed the event is determined by this priority. By default, 0 will load a plugin 'next' in the list of plugins who also are
- *      set to 0. Meaning if other plugins are already loaded at 0, and your plugin is also 0 your plugin will be last.
- *
- *      Plugins can force themselves sooner or later into the execution order by using this value (both negative and position).
- *      Negative values will place your plugin sooner in the execution order, while positive values will place it later.
- *
- *      Plugins should use 0 by default if order does not matter to their purpose.
- */
-int32_t Stockpile::GetPriority(void) const
-{
-    return 0;
-}
-
-/**
- * Returns the plugins flags.
- *
- * @return {uint32_t} The plugins flags.
- * @notes
- *
- *      Ashita offers a various number of events that can be invoked inside of a plugin, allowing plugins to have a lot of control
- *      over the flow of the game. However, this can create a lot of overhead, more specifically on lower end machines. Plugins can
- *      use this property to specify the exact events it plans to make use of, allowing Ashita to only invoke ones it needs.
- *
- *      Plugins should explicitly state which flags they plan to make use of and avoid using 'All' flags.
- *      This can help with the performance of the game for lower end machines.
- *
- *      See the 'Ashita::PluginFlags' enumeration for more information on what each flag does.
- */
-uint32_t Stockpile::GetFlags(void) const
-{
-    return (uint32_t) Ashita::PluginFlags::All;
-}
-
-/**
- * Event invoked when the plugin is being loaded and initialized.
- *
- * @param {IAshitaCore*} core - The main Ashita core instance used to interact with the Ashita hook.
- * @param {ILogManager*} logger - The log manager instance used to write to the debug log files.
- * @param {uint32_t} id - The plugins unique id. (Matches the plugins module base address.)
- * @return {bool} True on success, false otherwise.
- *
- * @notes
- *
- *      Plugins must return true from this function in order to be considered valid and continue to load.
- *      If your plugin fails to meet any requirements you feel are manditory for it to run, you should return false here and prevent it
- *      from loading further.
- */
-bool Stockpile::Initialize(IAshitaCore* core, ILogManager* logger, uint32_t id)
-{
-    this->m_AshitaCore = core;
-    this->m_LogManager = logger;
-    this->m_PluginId = id;
-
-    ::sprintf_s(this->window_title, "%s %.1f", this->GetName(), this->GetVersion());
-
-    return true;
-}
-
-/**
- * Event invoked when the plugin is being unloaded.
- *
- * @notes
- *
- *      Plugins should use this event to cleanup all resources they created or used during their lifespan.
- *      (ie. Fonts, primitives, textures, Direct3D related resources, memory allocations, etc.)
- */
-void Stockpile::Release(void)
-{
-
-}
-
-/**
- * Event invoked when an input command is being processed by the game client.
- *
- * @param {int32_t} mode - The mode of the command. (See: Ashita::CommandMode)
- * @param {const char*} command - The raw command string.
- * @param {bool} injected - Flag if the command was injected from an Ashita related resource. (Addon, plugin or internally.)
- * @return {bool} True if handled and should be blocked, false otherwise.
- *
- * @notes
- *
- *      Only invoked if Ashita::PluginFlags::UseCommands flag is set.
- *
- *      Any commands sent through the games input handler will be passed to plugins to be processed first allowing plugins to intercept
- *      and handle any kind of command they wish. This includes commands typed into the chat bar, commands invoked from macros, menu items
- *      and so on. Commands that have been injected by Ashita or another plugin will be marked via the injected parameter.
- *
- *      If a plugin returns true, the command is blocked from further processing by Ashita or the game client and is considered handled.
- *
- *      Plugins should return true for any commands they have handled or reacted to when appropriate. To prevent deadlocks by trying to
- *      inject another command here, plugins should instead use the IChatManager::QueueCommand function for any manual command inserts
- *      back into the game.
- */
-bool Stockpile::HandleCommand(int32_t mode, const char* command, bool injected)
-{
-    UNREFERENCED_PARAMETER(mode);
-    UNREFERENCED_PARAMETER(command);
-    UNREFERENCED_PARAMETER(injected);
-
-    return false;
-}
-
-/**
- * Event invoked when incoming text is being processed by the game client, to be added to the chat window.
- *
- * @param {int32_t} mode - The message mode. (Determines its base color.)
- * @param {bool} indent - Flag that determines if the message is indented.
- * @param {const char*} message - The raw message string.
- * @param {int32_t*} modifiedMode - The modified mode, if any, that has been altered by another addon/plugin.
- * @param {bool*} modifiedIndent - The modified indent flag, if any, that has been altered by another addon/plugin.
- * @param {char*} modifiedMessage - The modified message string, if any, that has been altered by another addon/plugin.
- * @param {bool} injected - Flag if the message was injected from an Ashita related resource. (Addon, plugin, or internally.)
- * @param {bool} blocked - Flag if the message has been blocked by another addon/plugin.
- * @return {bool} True if handled and should be blocked, false otherwise.
- *
- * @notes
- *
- *      Only invoked if Ashita::PluginFlags::UseText flag is set.
- *
- *      If a plugin returns true, the block flag is set to true (cannot be unset), however the message will still be passed to all loaded
- *      plugins whom are marked to accept the event. Plugins should check if the blocked flag has been set first before reacting to messages
- *      in case a previous plugin has deemed it to not be displayed in the game chat log. Unless your plugin requires reacting to certain/all
- *      messages, then it should simply return immediately if blocked is already true.
- *
- *      mode and message contain the original, unmodified data of the event which can be used to see what was originally used to invoke the
- *      event, as well as for plugins that require the original unedited message to properly operate. Plugins should however check for changes
- *      by seeing if modifiedMessage has been altered. If modifiedMessage has any value (strlen > 0) then plugins should honor previous plugin
- *      changes made to the message. You should only completely overwrite modifiedMessage if your plugin specifically needs to take over a given
- *      message. (For example if a certain plugin injects color tags into a message, your plugin should not remove them unless absolutely necessary.)
- *
- *      modifiedMessage is an internal buffer of 4096 bytes, therefore it should have plenty of space for any message you wish to add.
- *
- *      You should not call Write, Writef, or AddChatMessage functions here! Otherwise you will cause a stack overflow.
- */
-bool Stockpile::HandleIncomingText(int32_t mode, bool indent, const char* message, int32_t* modifiedMode, bool* modifiedIndent, char* modifiedMessage, bool injected, bool blocked)
-{
-    UNREFERENCED_PARAMETER(mode);
-    UNREFERENCED_PARAMETER(indent);
-    UNREFERENCED_PARAMETER(message);
-    UNREFERENCED_PARAMETER(modifiedMode);
-    UNREFERENCED_PARAMETER(modifiedIndent);
-    UNREFERENCED_PARAMETER(modifiedMessage);
-    UNREFERENCED_PARAMETER(injected);
-    UNREFERENCED_PARAMETER(blocked);
-
-    return false;
-}
-
-/**
- * Event invoked when the game client is processing an incoming packet.
- *
- * @param {uint16_t} id - The id of the packet.
- * @param {uint32_t} size - The size of the packet.
- * @param {const uint8_t*} data - The raw data of the packet.
- * @param {uint8_t*} modified - The modified packet data, if any, that has been altered by another addon/plugin.
- * @param {uint32_t} sizeChunk - The size of the full packet chunk that contained the packet.
- * @param {const uint8_t*} dataChunk - The raw data of the full packet chunk that contained the packet.
- * @param {bool} injected - Flag if the packet was injected from an Ashita related resource. (Addon, plugin, or internally.)
- * @param {bool} blocked - Flag if the packet has been blocked by another addon/plugin.
- * @return {bool} True if handled and should be blocked, false otherwise.
- *
- * @notes
- *
- *      Only invoked if Ashita::PluginFlags::UsePackets flag is set.
- *
- *      If a plugin returns true, the block flag is set to true (cannot be unset), however the event will still be passed to all loaded
- *      plugins whom are marked to accept it. Plugins should check if the blocked flag has been set first before reacting to the event
- *      in case a previous plugin has deemed it to be blocked. Unless your plugin requires reacting to certain/all packets, then it
- *      should simply return immediately if blocked is already true.
- *
- *      Packets in FFXI are sent in chunks, meaning there are multiple packets inside of each chunk. This information may be needed when
- *      dealing with certain packet ids, thus Ashita offers the ability to see the full chunk each packet was part of.
- *
- *      id, size, and data are all specific to the individual packet that caused the event to be invoked and contain the unmodified
- *      information about the individual packet. These should not be edited.
- *
- *      modified should be used to determine if changes have been made to the packet by Ashita or another addon/plugin. By default,
- *      modified is a direct copy of the original packet data.
- *
- *      sizeChunk and dataChunk hold the data of the entire chunk the packet was part of that is being processed in the event. These can
- *      be useful for plugins that may need to look at other packets in the chunk that relate to the current packet of the event. These
- *      should not be edited.
- */
-bool Stockpile::HandleIncomingPacket(uint16_t id, uint32_t size, const uint8_t* data, uint8_t* modified, uint32_t sizeChunk, const uint8_t* dataChunk, bool injected, bool blocked)
-{
-    UNREFERENCED_PARAMETER(id);
-    UNREFERENCED_PARAMETER(size);
-    UNREFERENCED_PARAMETER(data);
-    UNREFERENCED_PARAMETER(modified);
-    UNREFERENCED_PARAMETER(sizeChunk);
-    UNREFERENCED_PARAMETER(dataChunk);
-    UNREFERENCED_PARAMETER(injected);
-    UNREFERENCED_PARAMETER(blocked);
-
-    return false;
-}
-
-/**
- * Event invoked when the game client is processing an outgoing packet.
- *
- * @param {uint16_t} id - The id of the packet.
- * @param {uint32_t} size - The size of the packet.
- * @param {const uint8_t*} data - The raw data of the packet.
- * @param {uint8_t*} modified - The modified packet data, if any, that has been altered by another addon/plugin.
- * @param {uint32_t} sizeChunk - The size of the full packet chunk that contained the packet.
- * @param {const uint8_t*} dataChunk - The raw data of the full packet chunk that contained the packet.
- * @param {bool} injected - Flag if the packet was injected from an Ashita related resource. (Addon, plugin, or internally.)
- * @param {bool} blocked - Flag if the packet has been blocked by another addon/plugin.
- * @return {bool} True if handled and should be blocked, false otherwise.
- *
- * @notes
- *
- *      Only invoked if Ashita::PluginFlags::UsePackets flag is set.
- *
- *      If a plugin returns true, the block flag is set to true (cannot be unset), however the event will still be passed to all loaded
- *      plugins whom are marked to accept it. Plugins should check if the blocked flag has been set first before reacting to the event
- *      in case a previous plugin has deemed it to be blocked. Unless your plugin requires reacting to certain/all packets, then it
- *      should simply return immediately if blocked is already true.
- *
- *      Packets in FFXI are sent in chunks, meaning there are multiple packets inside of each chunk. This information may be needed when
- *      dealing with certain packet ids, thus Ashita offers the ability to see the full chunk each packet was part of.
- *
- *      id, size, and data are all specific to the individual packet that caused the event to be invoked and contain the unmodified
- *      information about the individual packet. These should not be edited.
- *
- *      modified should be used to determine if changes have been made to the packet by Ashita or another addon/plugin. By default,
- *      modified is a direct copy of the original packet data.
- *
- *      sizeChunk and dataChunk hold the data of the entire chunk the packet was part of that is being processed in the event. These can
- *      be useful for plugins that may need to look at other packets in the chunk that relate to the current packet of the event. These
- *      should not be edited.
- */
-bool Stockpile::HandleOutgoingPacket(uint16_t id, uint32_t size, const uint8_t* data, uint8_t* modified, uint32_t sizeChunk, const uint8_t* dataChunk, bool injected, bool blocked)
-{
-    UNREFERENCED_PARAMETER(id);
-    UNREFERENCED_PARAMETER(size);
-    UNREFERENCED_PARAMETER(data);
-    UNREFERENCED_PARAMETER(modified);
-    UNREFERENCED_PARAMETER(sizeChunk);
-    UNREFERENCED_PARAMETER(dataChunk);
-    UNREFERENCED_PARAMETER(injected);
-    UNREFERENCED_PARAMETER(blocked);
-
-    return false;
-}
-
-/**
- * Event invoked when the plugin is being initialized for Direct3D usage.
- *
- * @param {IDirect3DDevice8*} device - The Direct3D8 device object.
- * @return {bool} True on success, false otherwise.
- *
- * @notes
- *
- *      Only invoked if Ashita::PluginFlags::UseDirect3D flag is set.
- *
- *      Plugins must return true from this function in order to be considered valid and continue to load if they do use Direct3D features.
- *
- *      If your plugin fails to meet any Direct3D requirements you feel are manditory for it to run, you should return false here and
- *      prevent it from loading further.
- */
-bool Stockpile::Direct3DInitialize(IDirect3DDevice8* device)
-{
-    this->m_Direct3DDevice = device;
-
-    return true;
-}
-
-/**
- * Event invoked when the Direct3D device is beginning a scene.
- *
- * @param {bool} isRenderingBackBuffer - Flag set if the scene is being rendered to the back buffer.
- *
- * @notes
- *
- *      Only invoked if Ashita::PluginFlags::UseDirect3D flag is set.
- *
- *      This event is invoked before the actual IDirect3DDevice8::BeginScene call is invoked.
- *
- *      Multiple scenes can be rendered each frame, thus the isRenderingBackBuffer flag is available to determine when the scene is being
- *      rendered to the back buffer render target. (Previous Ashita versions only invoked this event when this flag would be true.)
- */
-void Stockpile::Direct3DBeginScene(bool isRenderingBackBuffer)
-{
-    UNREFERENCED_PARAMETER(isRenderingBackBuffer);
-
-    if (isRenderingBackBuffer)
-    {
-        // PLAYER
-        player_id = this->m_AshitaCore->GetMemoryManager()->GetParty()->GetMemberTargetIndex(0);
-
-        // ENTITY
-        entity = this->m_AshitaCore->GetMemoryManager()->GetEntity();
-
-        if (auto_pathing)
-        {
-
-            Pos pos_new{};
-
-            pos_new.x = entity->GetLocalPositionX(player_id);
-            pos_new.y = entity->GetLocalPositionY(player_id);
-            pos_new.z = entity->GetLocalPositionZ(player_id);
-
-            if (distance(pos_old, pos_new) >= range_auto_pathing)
-            {
-                auto_pathing_positions.push_back(pos_new);
-                pos_old = pos_new;
-            }
-        }
-
-        // ZONE CHANGE
-        if (zone_id != this->m_AshitaCore->GetMemoryManager()->GetParty()->GetMemberZone(0))
-        {
-            LoadMobDatData();
-            zone_id = this->m_AshitaCore->GetMemoryManager()->GetParty()->GetMemberZone(0);
-        }
-
-        // CHECK IF BOT IS RUNNING
-        if (running)
-        {
-            // RESET TARGETED
-            targeted_name = "No Valid Target";
-
-            // TARGET
-            target = this->m_AshitaCore->GetMemoryManager()->GetTarget();
-
-            // IDS
-            targeted_id = target->GetTargetIndex(target->GetIsSubTargetActive() ? 1 : 0);
-
-            // BOOLS
-            has_lock = target->GetLockedOnFlags() & 0x01;
-            has_target = targeted_id != 0;
-            is_player_dead = entity->GetStatus(player_id) == 2 || entity->GetStatus(player_id) == 3;
-
-            if (!is_player_dead)
-            {
-                ControlsReset();
-
-                // ATTACK IF ATTACKED
-                if (has_target)
-                {
-                    closest_target_id = targeted_id;
-                }
-
-                // NEW TARGET
-                if (closest_target_id == -1)
-                {
-                    // RESET CLOSEST TARGET
-                    closest_target_id = -1;
-
-                    float distance_target = FLT_MAX;
-
-                    // GET CLOSEST TARGET
-                    for (int index = 0; index < 2303; index++)
-                    {
-                        // entity.SpawnFlags[0x01 = PC, 0x02 = NPC, 0x10 = Mob, 0x0D = Self]
-                        // entity.EntityType[0 = PC, 1 = NPC, 2 = NPC(Fixed Models), 3 = Doors etc.]
-
-                        float entity_distance = entity->GetDistance(index);
-
-                        if (sqrt(entity_distance) <= range_new_target && entity->GetActorPointer(index) != 0 && entity->GetHPPercent(index) > 0 && entity->GetSpawnFlags(index) == 0x10 && sqrt(abs(entity->GetLocalPositionZ(player_id) - entity->GetLocalPositionZ(index))) < tolerance_z)
-                        {
-                            std::string search(entity->GetName(index));
-
-                            if (contains_find(mobs_selected, search))
-                            {
-                                if (sqrt(entity_distance) < distance_target)
-                                {
-                                    distance_target = sqrt(entity_distance);
-                                    closest_target_id = index;
-                                }
-                            }
-                        }
-                    }
-
-                    // SET NAME OF NEW TARGET
-                    if (closest_target_id == -1) 
-                    {
-                        closest_target_name = "No Valid Target";
-
-                        // USE PATHING
-                        float distance_pos = FLT_MAX;
-
-                        if (closest_path_id == -1)
-                        {
-                            Pos pos_new{};
-
-                            pos_new.x = entity->GetLocalPositionX(player_id);
-                            pos_new.y = entity->GetLocalPositionY(player_id);
-                            pos_new.z = entity->GetLocalPositionZ(player_id);
-
-                            for (int n = 0; n < int(auto_pathing_positions.size()); n++)
-                            {
-                                if (distance(auto_pathing_positions[n], pos_new) < distance_pos)
-                                {
-                                    distance_pos = distance(auto_pathing_positions[n], pos_new);
-                                    closest_path_id = n;
-                                }
-                            }
-                        }
-                        else
-                        {
-                            Pos pos = auto_pathing_positions[closest_path_id];
-
-                            float heading_difference = GetHeadingDifference(pos.x, pos.y);
-
-                            bool facing = abs(heading_difference) < tolerance_yaw * 2;
-
-                            if (!facing)
-                            {
-                                if (heading_difference < 0)
-                                {
-                                    ControlsDown("right");
-                                }
-                                if (heading_difference > 0)
-                                {
-                                    ControlsDown("left");
-                                }
-                            }
-                            
-                            ControlsDown("numpad8");
-
-                            Pos pos_new{};
-
-                            pos_new.x = entity->GetLocalPositionX(player_id);
-                            pos_new.y = entity->GetLocalPositionY(player_id);
-                            pos_new.z = entity->GetLocalPositionZ(player_id);
-
-                            if (sqrt(distance(auto_pathing_positions[closest_path_id], pos_new)) < range_next_path)
-                            {
-                                if (reverse_path)
-                                {
-                                    if (closest_path_id == int(auto_pathing_positions.size() - 1))
-                                    {
-                                        reverse_path = false;
-                                    }
-                                    else
-                                    {
-                                        closest_path_id++;
-                                    }
-                                }
-                                else
-                                {
-                                    if (closest_path_id == 0)
-                                    {
-                                        reverse_path = true;
-                                    }
-                                    else
-                                    {
-                                        closest_path_id--;
-                                    }
-                                }
-                            }
-                        }
-                    }
-                    else
-                    {
-                        closest_path_id = -1;
-                        closest_target_name = entity->GetName(closest_target_id);
-                        begin_new_target = std::chrono::steady_clock::now();
-                    }
-                }
-                else
-                {
-                    if (oldx == entity->GetLocalPositionX(closest_target_id) && oldy == entity->GetLocalPositionY(closest_target_id))
-                    {
-                        target_moving = false;
-                    }
-                    else
-                    {
-                        oldx = entity->GetLocalPositionX(closest_target_id);
-                        oldy = entity->GetLocalPositionY(closest_target_id);
-
-                        target_moving = true;
-                    }
-
-                    // GET CLOSEST TARGFET DISTANCE
-                    closest_target_distance = sqrt(entity->GetDistance(closest_target_id));
-
-                    float x2 = entity->GetLocalPositionX(closest_target_id);
-                    float y2 = entity->GetLocalPositionY(closest_target_id);
-
-                    float heading_difference = GetHeadingDifference(x2, y2);
-
-                    // RANGE BRACKETS
-                    bool gt_bracket_new_target = closest_target_distance >= range_new_target;
-                    bool gt_bracket_engage = closest_target_distance >= range_engage;
-                    bool gt_bracket_attacking = closest_target_distance >= range_attacking;
-                    bool gt_bracket_attacking_and_lt_bracket_engage = closest_target_distance >= range_attacking && closest_target_distance < range_engage;
-                    bool lt_bracket_minimum = closest_target_distance < range_minimum;
-                    bool lt_bracket_engage = closest_target_distance < range_engage;
-
-                    // FACING
-                    bool facing = abs(heading_difference) < tolerance_yaw;
-
-                    // CLAIMED
-                    bool claimed = entity->GetClaimStatus(closest_target_id) == entity->GetServerId(player_id) || entity->GetClaimStatus(closest_target_id) == 0;
-
-                    // HAS TARGET
-                    if (has_target)
-                    {
-                        // UNLOCK SELF & UNLOCK CLAIMS
-                        if (targeted_id == player_id) {
-                            QueueCommand(-1, std::format("/sendkey escape down"));
-                            QueueCommand(-1, std::format("/sendkey escape up"));
-                        }
-
-                        targeted_name = entity->GetName(targeted_id);
-                    }
-
-                    // GET NEW CLOSEST TARGET
-                    if (gt_bracket_new_target || !claimed || entity->GetHPPercent(closest_target_id) == 0 || entity->GetActorPointer(closest_target_id) == 0 || entity->GetStatusServer(closest_target_id) == 2 || entity->GetStatusServer(closest_target_id) == 3) {
-                        closest_target_id = -1;
-                        targeted_id = -1;
-                    }
-
-                    // MOVE TO TARGET WITH NUMPAD
-                    if (!has_lock) {
-                        // MOVE LEFT OR RIGHT
-                        if (gt_bracket_engage)
-                        {
-                            if (!facing)
-                            {
-                                if (heading_difference < 0)
-                                {
-                                    ControlsDown("right");
-                                }
-                                if (heading_difference > 0)
-                                {
-                                    ControlsDown("left");
-                                }
-                            }
-                        }
-
-                        // SELECT TARGET
-                        if (std::chrono::duration_cast<std::chrono::seconds>(std::chrono::steady_clock::now() - begin_new_target).count() >= 5 && gt_bracket_attacking_and_lt_bracket_engage) {
-                            if (std::chrono::duration_cast<std::chrono::seconds>(std::chrono::steady_clock::now() - begin_new_select).count() >= 3)
-                            {
-                                target->SetTarget(closest_target_id, false);
-                                begin_new_select = std::chrono::steady_clock::now();
-                            }
-                        }
-                    }
-
-                    // ATTACK TARGET
-                    if (has_target && !has_lock && lt_bracket_engage) {
-                        if (std::chrono::duration_cast<std::chrono::seconds>(std::chrono::steady_clock::now() - begin_new_attack).count() >= 3)
-                        {
-                            QueueCommand(-1, std::format("/attack"));
-                            begin_new_attack = std::chrono::steady_clock::now();
-                        }
-                    }
-
-                    // MOVE FORWARD OR BACKWARDS
-                    if ((has_target && has_lock && gt_bracket_attacking) || (!has_lock && gt_bracket_attacking) || target_moving)
-                    {
-                        ControlsDown("numpad8");
-                    }
-                    else if ((has_target && has_lock && lt_bracket_minimum) || (has_target && has_lock && !facing))
-                    {
-                        ControlsDown("numpad2");
-                    }
-                }
-
-                Controls();
-            }
-        }
-    }
-}
-
-float Stockpile::GetHeadingDifference(float x2, float y2)
-{
-    // TARGET DATA
-    float h1 = entity->GetHeading(player_id);
-    float x1 = entity->GetLocalPositionX(player_id);
-    float y1 = entity->GetLocalPositionY(player_id);
-
-    float radians = atan2(-(y2 - y1), x2 - x1);
-
-    float difference = radians - h1;
-    float pi = float(M_PI);
-
-    if (difference < -pi)
-    {
-        difference = difference + 2 * pi;
-    }
-
-    if (difference > pi)
-    {
-        difference = difference - 2 * pi;
-    }
-
-    return difference;
-}
-
-void Stockpile::LoadMobDatData()
-{
-    char buffer[MAX_PATH]{};
-    if (!Ashita::Registry::GetInstallPath(Ashita::LanguageId::Default, Ashita::SquareEnixGameId::FinalFantasyXI, buffer, MAX_PATH))
-    {
-        Log("Failed to load zone mob data.");
-        return;
-    }
-
-    const auto zone = this->m_AshitaCore->GetMemoryManager()->GetParty()->GetMemberZone(0);
-    if (!ZoneMap.contains(zone))
-    {
-        Log("Failed to locate required map entry.");
-        return;
-    }
-
-    std::filesystem::path path = buffer;
-
-    std::error_code ec{};
-    if (!std::filesystem::exists(path, ec) || ec)
-    {
-        Log("Failed to locate required map DAT file.");
-        return;
-    }
-
-    path += "\\";
-    path += std::get<0>(ZoneMap[zone]);
-
-    Log(std::format("Loading ({}) {}", zone, std::get<1>(ZoneMap[zone])));
-    Log(std::format("Path: {}", path.string()));
-
-    FILE* f = nullptr;
-    if (::fopen_s(&f, path.string().c_str(), "rb") != ERROR_SUCCESS)
-    {
-        Log("Failed to open zone mob list DAT file.");
-        return;
-    }
-
-    ::fseek(f, 0, SEEK_END);
-    const auto size = ::ftell(f);
-    ::fseek(f, 0, SEEK_SET);
-
-    if (size == 0 || (size % 0x20) != 0)
-    {
-        ::fclose(f);
-
-        Log("Mob zone list is invalid / incorrectly sized.");
-        return;
-    }
-
-    // 0000 - 1023 = static zone entities.
-    // 1024 - 1791 = players
-    // 1792 - 2303 = spawnables (pets, summons, dynamic event entities, etc.)
-
-    for (auto x = 0; x < size / 0x20; x++)
-    {
-        MobDatData mob_dat_data{};
-        ::fread(&mob_dat_data, sizeof(mob_dat_data.name) + sizeof(mob_dat_data.server_id), 1, f);
-
-        mob_dat_data.target_index = mob_dat_data.server_id & 0x07FF;
-        mob_dat_data.zone_id = (mob_dat_data.server_id >> 0x0C) & 0x7F;
-
-        mobs.push_back(mob_dat_data);
-
-        std::string name(mob_dat_data.name);
-
-        trim(name);
-
-        if (!contains_find(mobs_common_bans, name))
-        {
-            mobs_unique_names.push_back(name);
-        }
-    }
-
-    std::sort(mobs_unique_names.begin(), mobs_unique_names.end());
-    mobs_unique_names.erase(std::unique(mobs_unique_names.begin(), mobs_unique_names.end()), mobs_unique_names.end());
-
-    Log(std::format("Mobs: {}", mobs.size()));
-    Log(std::format("Mobs Unique: {}", mobs_unique_names.size()));
-
-    ::fclose(f);
-}
-
-/**
- * Event invoked when the Direct3D device is ending a scene.
- *
- * @param {bool} isRenderingBackBuffer - Flag set if the scene is being rendered to the back buffer.
- *
- * @notes
- *
- *      Only invoked if Ashita::PluginFlags::UseDirect3D flag is set.
- *
- *      This event is invoked before the actual IDirect3DDevice8::EndScene call is invoked.
- *
- *      Multiple scenes can be rendered each frame, thus the isRenderingBackBuffer flag is available to determine when the scene is being
- *      rendered to the back buffer render target. (Previous Ashita versions only invoked this event when this flag would be true.)
- */
-void Stockpile::Direct3DEndScene(bool isRenderingBackBuffer)
-{
-    UNREFERENCED_PARAMETER(isRenderingBackBuffer);
-}
-
-/**
- * Event invoked when the Direct3D device is presenting a scene.
- *
- * @param {const RECT*} pSourceRect - The source rect being presented.
- * @param {const RECT*} pDestRect - The destination rect being presented into.
- * @param {HWND} hDestWindowOverride - The override window handle to present into.
- * @param {const RGNDATA*} pDirtyRegion - The present dirty regions.
- *
- * @notes
- *
- *      Only invoked if Ashita::PluginFlags::UseDirect3D flag is set.
- *
- *      This event is invoked before the actual IDirect3DDevice8::Present call is invoked.
- *
- *      For best results of custom Direct3D rendering, it is best to do your own custom drawing here to draw over-top of all game related
- *      scenes and objects. Usage of ImGui should be done here as well.
- */
-void Stockpile::Direct3DPresent(const RECT* pSourceRect, const RECT* pDestRect, HWND hDestWindowOverride, const RGNDATA* pDirtyRegion)
-{
-    UNREFERENCED_PARAMETER(pSourceRect);
-    UNREFERENCED_PARAMETER(pDestRect);
-    UNREFERENCED_PARAMETER(hDestWindowOverride);
-    UNREFERENCED_PARAMETER(pDirtyRegion);
-
-    /**
-     * Ashita's Current Default Styling
-    */
-
-    /*
-    auto& style = imgui->GetStyle();
-    style.ChildRounding = 0.0f;
-    style.FrameBorderSize = 1.0f;
-    style.FramePadding = ImVec2(4.0f, 3.0f);
-    style.FrameRounding = 0.0f;
-    style.GrabRounding = 0.0f;
-    style.ItemSpacing = ImVec2(8.0f, 4.0f);
-    style.ItemInnerSpacing = ImVec2(4.0f, 4.0f);
-    style.TabBorderSize = 1.0f;
-    style.TabRounding = 0.0f;
-    style.ScrollbarRounding = 0.0f;
-    style.WindowBorderSize = 1.0f;
-    style.WindowPadding = ImVec2(8.0f, 8.0f);
-    style.WindowRounding = 2.0f;
-
-    const auto colors = style.Colors;
-    colors[ImGuiCol_Text] = ImVec4(0.94f, 0.94f, 0.94f, 1.00f);
-    colors[ImGuiCol_TextDisabled] = ImVec4(0.94f, 0.94f, 0.94f, 0.29f);
-    colors[ImGuiCol_WindowBg] = ImVec4(0.18f, 0.20f, 0.23f, 0.96f);
-    colors[ImGuiCol_ChildBg] = ImVec4(0.22f, 0.24f, 0.27f, 0.96f);
-    colors[ImGuiCol_PopupBg] = ImVec4(0.05f, 0.05f, 0.10f, 0.90f);
-    colors[ImGuiCol_Border] = ImVec4(0.05f, 0.05f, 0.10f, 0.80f);
-    colors[ImGuiCol_BorderShadow] = ImVec4(0.00f, 0.00f, 0.00f, 0.00f);
-    colors[ImGuiCol_FrameBg] = ImVec4(0.16f, 0.17f, 0.20f, 1.00f);
-    colors[ImGuiCol_FrameBgHovered] = ImVec4(0.14f, 0.14f, 0.14f, 0.78f);
-    colors[ImGuiCol_FrameBgActive] = ImVec4(0.12f, 0.12f, 0.12f, 1.00f);
-    colors[ImGuiCol_TitleBg] = ImVec4(0.83f, 0.33f, 0.28f, 0.69f);
-    colors[ImGuiCol_TitleBgActive] = ImVec4(0.83f, 0.33f, 0.28f, 1.00f);
-    colors[ImGuiCol_TitleBgCollapsed] = ImVec4(0.83f, 0.33f, 0.28f, 0.50f);
-    colors[ImGuiCol_MenuBarBg] = ImVec4(0.12f, 0.13f, 0.17f, 1.00f);
-    colors[ImGuiCol_ScrollbarBg] = ImVec4(0.12f, 0.13f, 0.17f, 1.00f);
-    colors[ImGuiCol_ScrollbarGrab] = ImVec4(0.83f, 0.33f, 0.28f, 0.69f);
-    colors[ImGuiCol_ScrollbarGrabHovered] = ImVec4(0.83f, 0.33f, 0.28f, 1.00f);
-    colors[ImGuiCol_ScrollbarGrabActive] = ImVec4(0.83f, 0.33f, 0.28f, 1.00f);
-    colors[ImGuiCol_CheckMark] = ImVec4(0.83f, 0.33f, 0.28f, 1.00f);
-    colors[ImGuiCol_SliderGrab] = ImVec4(0.83f, 0.33f, 0.28f, 0.69f);
-    colors[ImGuiCol_SliderGrabActive] = ImVec4(0.83f, 0.33f, 0.28f, 1.00f);
-    colors[ImGuiCol_Button] = ImVec4(0.83f, 0.33f, 0.28f, 0.78f);
-    colors[ImGuiCol_ButtonHovered] = ImVec4(0.83f, 0.33f, 0.28f, 1.00f);
-    colors[ImGuiCol_ButtonActive] = ImVec4(0.83f, 0.33f, 0.28f, 1.00f);
-    colors[ImGuiCol_Header] = ImVec4(0.83f, 0.33f, 0.28f, 0.78f);
-    colors[ImGuiCol_HeaderHovered] = ImVec4(0.83f, 0.33f, 0.28f, 1.00f);
-    colors[ImGuiCol_HeaderActive] = ImVec4(0.83f, 0.33f, 0.28f, 1.00f);
-    colors[ImGuiCol_Separator] = ImVec4(0.43f, 0.43f, 0.50f, 0.50f);
-    colors[ImGuiCol_SeparatorHovered] = ImVec4(0.10f, 0.40f, 0.75f, 0.78f);
-    colors[ImGuiCol_SeparatorActive] = ImVec4(0.10f, 0.40f, 0.75f, 1.00f);
-    colors[ImGuiCol_ResizeGrip] = ImVec4(0.05f, 0.05f, 0.05f, 0.69f);
-    colors[ImGuiCol_ResizeGripHovered] = ImVec4(0.83f, 0.33f, 0.28f, 1.00f);
-    colors[ImGuiCol_ResizeGripActive] = ImVec4(0.83f, 0.33f, 0.28f, 1.00f);
-    colors[ImGuiCol_Tab] = ImVec4(0.05f, 0.05f, 0.05f, 0.69f);
-    colors[ImGuiCol_TabHovered] = ImVec4(0.83f, 0.33f, 0.28f, 1.00f);
-    colors[ImGuiCol_TabActive] = ImVec4(0.83f, 0.33f, 0.28f, 1.00f);
-    colors[ImGuiCol_PlotLines] = ImVec4(0.83f, 0.33f, 0.28f, 1.00f);
-    colors[ImGuiCol_PlotLinesHovered] = ImVec4(0.81f, 0.81f, 0.81f, 1.00f);
-    colors[ImGuiCol_PlotHistogram] = ImVec4(0.83f, 0.33f, 0.28f, 1.00f);
-    colors[ImGuiCol_PlotHistogramHovered] = ImVec4(0.81f, 0.81f, 0.81f, 1.00f);
-    colors[ImGuiCol_TableHeaderBg] = ImVec4(0.05f, 0.05f, 0.05f, 0.69f);
-    colors[ImGuiCol_TableBorderStrong] = ImVec4(0.10f, 0.10f, 0.10f, 1.00f);
-    colors[ImGuiCol_TableBorderLight] = ImVec4(0.15f, 0.15f, 0.15f, 1.00f);
-    colors[ImGuiCol_TextSelectedBg] = ImVec4(0.83f, 0.33f, 0.28f, 0.50f);
-    colors[ImGuiCol_DragDropTarget] = ImVec4(1.00f, 1.00f, 0.00f, 0.90f);
-    colors[ImGuiCol_NavHighlight] = ImVec4(1.00f, 1.00f, 0.00f, 1.00f);
-    colors[ImGuiCol_NavWindowingHighlight] = ImVec4(0.83f, 0.33f, 0.28f, 1.00f);
-    colors[ImGuiCol_NavWindowingDimBg] = ImVec4(0.00f, 0.00f, 0.00f, 0.60f);
-    colors[ImGuiCol_ModalWindowDimBg] = ImVec4(0.05f, 0.05f, 0.05f, 0.78f);
-    */
-
-    // GUI START
-    const auto& imgui = m_AshitaCore->GetGuiManager();
-
-    imgui->SetNextWindowSize(ImVec2(0, 0), ImGuiCond_Always); // SIZE OF GUI
-
-    if (!imgui->Begin(this->window_title)) {
-        imgui->End();
-        return;
-    }
-
-    // GUI PADDING
-    imgui->PushStyleVar(ImGuiStyleVar_FramePadding, ImVec2(6, 6));
-
-    // ADD GUI ELEMENTS...
-    if (imgui->Button("Start Bot", ImVec2(150, 27))) {
-        running = true;
-        auto_pathing = false;
-    }
-
-    imgui->SameLine();
-
-    if (imgui->Button("Stop Bot", ImVec2(150, 27))) {
-        running = false;
-        Stockpile::ControlsReload();
-    }
-
-    char buff[256]{};
-
-    sprintf_s(buff, "Running: %s", running ? "True" : "False");
-    imgui->TextColored(running ? green : red, buff);
-
-    if (imgui->CollapsingHeader("Status's"))
-    {
-        sprintf_s(buff, "Has Target: %s", has_target ? "True" : "False");
-        imgui->TextColored(has_target ? green : red, buff);
-
-        sprintf_s(buff, "Has Lock: %s", has_lock ? "True" : "False");
-        imgui->TextColored(has_lock ? green : red, buff);
-
-        sprintf_s(buff, "Closest Target Name: %s", closest_target_name);
-        imgui->Text(buff);
-
-        sprintf_s(buff, "Closest Target ID: %d", closest_target_id);
-        imgui->TextColored(closest_target_id != -1 ? green : red, buff);
-
-        sprintf_s(buff, "Closest Target Distance: %.2f", closest_target_distance);
-        imgui->Text(buff);
-
-        sprintf_s(buff, "Target Name: %s", targeted_name);
-        imgui->Text(buff);
-
-        sprintf_s(buff, "Target ID: %d", targeted_id);
-        imgui->TextColored(targeted_id != -1 ? green : red, buff);
-    }
-
-    if (imgui->CollapsingHeader("Settings (Tolerance & Range) "))
-    {
-
-        imgui->SliderFloat("Tolerance Yaw", &tolerance_yaw, 0.1f, 0.5f, "%.2f");
-        imgui->SliderFloat("Tolerance Z", &tolerance_z, 0.5f, 20.0f, "%.2f");
-
-        imgui->SliderFloat("Range New Target", &range_new_target, 20.0f, 50.0f, "%.2f");
-        imgui->SliderFloat("Range Engage", &range_engage, 10.0f, 30.0f, "%.2f");
-        imgui->SliderFloat("Range Attacking", &range_attacking, 2.0f, 4.0f, "%.2f");
-        imgui->SliderFloat("Range Minimum", &range_minimum, 1.0f, 2.0f, "%.2f");
-    }
-
-    if (imgui->CollapsingHeader("Targets"))
-    {
-        // MANUAL TARGET
-        imgui->Text("Target Name:");
-
-        imgui->InputText("", mtarget, IM_ARRAYSIZE(mtarget));
-
-        if (imgui->Button("Add Target", ImVec2(150, 27))) {
-            Log(std::format("Added: {}", mtarget));
-            mobs_selected.push_back(mtarget);
-        }
-
-        imgui->Checkbox("Include Potentially Invalid Targets", &include_pit);
-
-        imgui->Text("Double click to add or remove targets.");
-
-        if (imgui->ListBoxHeader("Available Targets"))
-        {
-            for (int n = 0; n < int(mobs_unique_names.size()); n++)
-            {
-                if (include_pit || !contains_search(mobs_potential_bans, mobs_unique_names[n]))
-                {
-                    const bool is_selected = (item_current_idx == n);
-
-                    if (imgui->Selectable(mobs_unique_names[n].c_str(), is_selected, ImGuiSelectableFlags_AllowDoubleClick))
-                    {
-                        item_current_idx = n;
-
-                        if (imgui->IsMouseDoubleClicked(0))
-                        {
-                            if (!contains_find(mobs_selected, mobs_unique_names[item_current_idx])) {
-                                mobs_selected.push_back(mobs_unique_names[item_current_idx]);
-
-                                Log(std::format("Added: {}", mobs_unique_names[item_current_idx]));
-                            }
-                        }
-                    }
-                }
-            }
-            imgui->ListBoxFooter();
-        }
-
-        int remove = -1;
-
-        if (imgui->ListBoxHeader("Selected Targets"))
-        {
-            for (int n = 0; n < int(mobs_selected.size()); n++)
-            {
-                const bool is_selected = (item_current_idx == n);
-
-                if (imgui->Selectable(mobs_selected[n].c_str(), is_selected, ImGuiSelectableFlags_AllowDoubleClick))
-                {
-                    item_current_idx = n;
-
-                    if (imgui->IsMouseDoubleClicked(0))
-                    {
-                        remove = item_current_idx;
-                    }
-                }
-            }
-            imgui->ListBoxFooter();
-        }
-
-        if (remove != -1) {
-            Log(std::format("Removed: {}", mobs_selected[item_current_idx].c_str()));
-
-            mobs_selected.erase(mobs_selected.begin() + item_current_idx);
-            remove = -1;
-        }
-    }
-
-    if (imgui->CollapsingHeader("Pathing"))
-    {
-        if (imgui->Button("Start Auto-Pathing", ImVec2(150, 27))) {
-            auto_pathing = true;
-        }
-
-        imgui->SameLine();
-
-        if (imgui->Button("Stop Auto-Pathing", ImVec2(150, 27))) {
-            auto_pathing = false;
-        }
-
-        imgui->SliderFloat("Distance Auto-Pathing", &range_auto_pathing, 5.0f, 30.0f, "%.1f");
-        imgui->SliderFloat("Range to proccess next node", &range_next_path, 3.0f, 5.0f, "%.1f");
-
-        sprintf_s(buff, "Auto-Pathing Running: %s", auto_pathing ? "True" : "False");
-        imgui->TextColored(auto_pathing ? green : red, buff);
-
-        int remove = -1;
-
-        if (imgui->ListBoxHeader("Pathing Positions"))
-        {
-            for (int n = 0; n < int(auto_pathing_positions.size()); n++)
-            {
-                const bool is_selected = (item_current_idx == n);
-
-                Pos p = auto_pathing_positions[n];
-
-                if (imgui->Selectable(std::format("[{}] {:.1f}, {:.1f}, {:.1f}", n, p.x, p.y, p.z).c_str(), is_selected, ImGuiSelectableFlags_AllowDoubleClick))
-                {
-                    item_current_idx = n;
-
-                    if (imgui->IsMouseDoubleClicked(0))
-                    {
-                        remove = item_current_idx;
-                    }
-                }
-            }
-            imgui->ListBoxFooter();
-        }
-
-        if (remove != -1) {
-            Pos p = auto_pathing_positions[item_current_idx];
-
-            Log(std::format("[{}] {:.1f}, {:.1f}, {:.1f}", item_current_idx, p.x, p.y, p.z).c_str());
-
-            auto_pathing_positions.erase(auto_pathing_positions.begin() + item_current_idx);
-            remove = -1;
-        }
-
-        if (imgui->Button("Remove All", ImVec2(150, 27))) {
-            running = false;
-            auto_pathing_positions.clear();
-        }
-    }
-
-    // GUI POP STYLE VAR
-    imgui->PopStyleVar();
-
-    // GUI END
-    imgui->End();
-
-    // imgui->ShowDemoWindow();
-}
-
-/**
- * Returns an instance of this plugins main class.
- *
- * @param {const char*} args - The arguments passed to the plugin when it was loaded.
- * @return {IPlugin*} The plugins class object instance.
- * @notes
- *
- *      This export must be present for a plugin to load properly!
- *
- *      The args parameter can be used to prepare the plugin in any special manner for specific properties based on the arguments passed.
- *      For example, if you wish to have a password required to load the plugin, this can be used for that kind of thing. (Not recommended
- *      as this is a weak form of authentication, just an example.)
- */
-__declspec(dllexport) IPlugin* __stdcall expCreatePlugin(const char* args)
-{
-    UNREFERENCED_PARAMETER(args);
-
-    return new Stockpile();
-}
-
-/**
- * Returns the plugins Ashita interface version it was compiled against.
- *
- * @return {double} The plugins interface version.
- * @notes
- *
- *      This export must be present for a plugin to load properly!
- */
-__declspec(dllexport) double __stdcall expGetInterfaceVersion(void)
-{
-    return ASHITA_INTERFACE_VERSION;
-}
-
+#ifndef SOCKPILE_H_INCLUDED
+#define SOCKPILE_H_INCLUDED
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#define _USE_MATH_DEFINES
+
+#include "Stockpile.h"
+#include "Zones.h"
+
+/**
+ * Constructor and Deconstructor
+ */
+Stockpile::Stockpile(void)
+    : m_AshitaCore(nullptr)
+    , m_LogManager(nullptr)
+    , m_Direct3DDevice(nullptr)
+    , m_PluginId(0)
+{}
+Stockpile::~Stockpile(void)
+{}
+
+/**
+ * Returns the plugins name.
+ *
+ * @return {const char*} The plugins name.
+ */
+const char* Stockpile::GetName(void) const
+{
+    return "Stockpile";
+}
+
+/**
+ * Returns the plugins author.
+ *
+ * @return {const char*} The plugins author.
+ */
+const char* Stockpile::GetAuthor(void) const
+{
+    return "Fentus";
+}
+
+/**
+ * Returns the plugins description.
+ *
+ * @return {const char*} The plugins description.
+ */
+const char* Stockpile::GetDescription(void) const
+{
+    return "Combat Bot";
+}
+
+/**
+ * returns the plugins homepage link.
+ *
+ * @return {const char*} The plugins homepage link.
+ */
+const char* Stockpile::GetLink(void) const
+{
+    return "https://fentusgames.com/";
+}
+
+/**
+ * Returns the plugins version.
+ *
+ * @return {double} The plugins version.
+ */
+double Stockpile::GetVersion(void) const
+{
+    return 1;
+}
+
+/**
+ * Returns the plugins Ashita interface version it was compiled against.
+ *
+ * @return {double} The plugins interface version.
+ */
+double Stockpile::GetInterfaceVersion(void) const
+{
+    return ASHITA_INTERFACE_VERSION;
+}
+
+/**
+ * Returns the plugins execution priority.
+ *
+ * @return {int32_t} The plugins execution priority.
+ * @notes
+ *
+ *      The priority value is used to determine the execution order of the plugins loaded in Ashita. When an event is fired, Ashita
+ *      will loop through each of the loaded plugins and allow them to attempt to handle the event. The order that the plugins are
+ *      passed the event is determined by this priority. By default, 0 will load a plugin 'next' in the list of plugins who also are
+ *      set to 0. Meaning if other plugins are already loaded at 0, and your plugin is also 0 your plugin will be last.
+ *
+ *      Plugins can force themselves sooner or later into the execution order by using this value (both negative and position).
+ *      Negative values will place your plugin sooner in the execution order, while positive values will place it later.
+ *
+ *      Plugins should use 0 by default if order does not matter to their purpose.
+ */
+int32_t Stockpile::GetPriority(void) const
+{
+    return 0;
+}
+
+/**
+ * Returns the plugins flags.
+ *
+ * @return {uint32_t} The plugins flags.
+ * @notes
+ *
+ *      Ashita offers a various number of events that can be invoked inside of a plugin, allowing plugins to have a lot of control
+ *      over the flow of the game. However, this can create a lot of overhead, more specifically on lower end machines. Plugins can
+ *      use this property to specify the exact events it plans to make use of, allowing Ashita to only invoke ones it needs.
+ *
+ *      Plugins should explicitly state which flags they plan to make use of and avoid using 'All' flags.
+ *      This can help with the performance of the game for lower end machines.
+ *
+ *      See the 'Ashita::PluginFlags' enumeration for more information on what each flag does.
+ */
+uint32_t Stockpile::GetFlags(void) const
+{
+    return (uint32_t) Ashita::PluginFlags::All;
+}
+
+/**
+ * Event invoked when the plugin is being loaded and initialized.
+ *
+ * @param {IAshitaCore*} core - The main Ashita core instance used to interact with the Ashita hook.
+ * @param {ILogManager*} logger - The log manager instance used to write to the debug log files.
+ * @param {uint32_t} id - The plugins unique id. (Matches the plugins module base address.)
+ * @return {bool} True on success, false otherwise.
+ *
+ * @notes
+ *
+ *      Plugins must return true from this function in order to be considered valid and continue to load.
+ *      If your plugin fails to meet any requirements you feel are manditory for it to run, you should return false here and prevent it
+ *      from loading further.
+ */
+bool Stockpile::Initialize(IAshitaCore* core, ILogManager* logger, uint32_t id)
+{
+    this->m_AshitaCore = core;
+    this->m_LogManager = logger;
+    this->m_PluginId = id;
+
+    ::sprintf_s(this->window_title, "%s %.1f", this->GetName(), this->GetVersion());
+
+    CompileMatcher();
+
+    timers.Start(Milliseconds());
+
+    ActionsInitialize();
+
+#if defined(_WIN32)
+    if (!claims.Open("Local\\StockpileClaims", Milliseconds()))
+#else
+    if (!claims.Open("/stockpile_claims", Milliseconds()))
+#endif
+    {
+        Log("Failed to open the shared claim table, targets will not be coordinated.");
+    }
+
+    WorkerStart();
+
+    return true;
+}
+
+/**
+ * Event invoked when the plugin is being unloaded.
+ *
+ * @notes
+ *
+ *      Plugins should use this event to cleanup all resources they created or used during their lifespan.
+ *      (ie. Fonts, primitives, textures, Direct3D related resources, memory allocations, etc.)
+ */
+void Stockpile::Release(void)
+{
+    WorkerStop();
+    NavStop();
+
+    capture.Close();
+    claims.Close();
+}
+
+/**
+ * Event invoked when an input command is being processed by the game client.
+ *
+ * @param {int32_t} mode - The mode of the command. (See: Ashita::CommandMode)
+ * @param {const char*} command - The raw command string.
+ * @param {bool} injected - Flag if the command was injected from an Ashita related resource. (Addon, plugin or internally.)
+ * @return {bool} True if handled and should be blocked, false otherwise.
+ *
+ * @notes
+ *
+ *      Only invoked if Ashita::PluginFlags::UseCommands flag is set.
+ *
+ *      Any commands sent through the games input handler will be passed to plugins to be processed first allowing plugins to intercept
+ *      and handle any kind of command they wish. This includes commands typed into the chat bar, commands invoked from macros, menu items
+ *      and so on. Commands that have been injected by Ashita or another plugin will be marked via the injected parameter.
+ *
+ *      If a plugin returns true, the command is blocked from further processing by Ashita or the game client and is considered handled.
+ *
+ *      Plugins should return true for any commands they have handled or reacted to when appropriate. To prevent deadlocks by trying to
+ *      inject another command here, plugins should instead use the IChatManager::QueueCommand function for any manual command inserts
+ *      back into the game.
+ */
+bool Stockpile::HandleCommand(int32_t mode, const char* command, bool injected)
+{
+    UNREFERENCED_PARAMETER(mode);
+    UNREFERENCED_PARAMETER(command);
+    UNREFERENCED_PARAMETER(injected);
+
+    return false;
+}
+
+/**
+ * Event invoked when incoming text is being processed by the game client, to be added to the chat window.
+ *
+ * @param {int32_t} mode - The message mode. (Determines its base color.)
+ * @param {bool} indent - Flag that determines if the message is indented.
+ * @param {const char*} message - The raw message string.
+ * @param {int32_t*} modifiedMode - The modified mode, if any, that has been altered by another addon/plugin.
+ * @param {bool*} modifiedIndent - The modified indent flag, if any, that has been altered by another addon/plugin.
+ * @param {char*} modifiedMessage - The modified message string, if any, that has been altered by another addon/plugin.
+ * @param {bool} injected - Flag if the message was injected from an Ashita related resource. (Addon, plugin, or internally.)
+ * @param {bool} blocked - Flag if the message has been blocked by another addon/plugin.
+ * @return {bool} True if handled and should be blocked, false otherwise.
+ *
+ * @notes
+ *
+ *      Only invoked if Ashita::PluginFlags::UseText flag is set.
+ *
+ *      If a plugin returns true, the block flag is set to true (cannot be unset), however the message will still be passed to all loaded
+ *      plugins whom are marked to accept the event. Plugins should check if the blocked flag has been set first before reacting to messages
+ *      in case a previous plugin has deemed it to not be displayed in the game chat log. Unless your plugin requires reacting to certain/all
+ *      messages, then it should simply return immediately if blocked is already true.
+ *
+ *      mode and message contain the original, unmodified data of the event which can be used to see what was originally used to invoke the
+ *      event, as well as for plugins that require the original unedited message to properly operate. Plugins should however check for changes
+ *      by seeing if modifiedMessage has been altered. If modifiedMessage has any value (strlen > 0) then plugins should honor previous plugin
+ *      changes made to the message. You should only completely overwrite modifiedMessage if your plugin specifically needs to take over a given
+ *      message. (For example if a certain plugin injects color tags into a message, your plugin should not remove them unless absolutely necessary.)
+ *
+ *      modifiedMessage is an internal buffer of 4096 bytes, therefore it should have plenty of space for any message you wish to add.
+ *
+ *      You should not call Write, Writef, or AddChatMessage functions here! Otherwise you will cause a stack overflow.
+ */
+bool Stockpile::HandleIncomingText(int32_t mode, bool indent, const char* message, int32_t* modifiedMode, bool* modifiedIndent, char* modifiedMessage, bool injected, bool blocked)
+{
+    UNREFERENCED_PARAMETER(indent);
+    UNREFERENCED_PARAMETER(modifiedMode);
+    UNREFERENCED_PARAMETER(modifiedIndent);
+    UNREFERENCED_PARAMETER(modifiedMessage);
+    UNREFERENCED_PARAMETER(blocked);
+
+    // A LINE ANOTHER PLUGIN BLOCKED STILL HAPPENED, OUR OWN LOGS ARE INJECTED
+    if (!running || injected || message == nullptr)
+    {
+        return false;
+    }
+
+    OnChatLine(mode, message);
+
+    return false;
+}
+
+/**
+ * Event invoked when the game client is processing an incoming packet.
+ *
+ * @param {uint16_t} id - The id of the packet.
+ * @param {uint32_t} size - The size of the packet.
+ * @param {const uint8_t*} data - The raw data of the packet.
+ * @param {uint8_t*} modified - The modified packet data, if any, that has been altered by another addon/plugin.
+ * @param {uint32_t} sizeChunk - The size of the full packet chunk that contained the packet.
+ * @param {const uint8_t*} dataChunk - The raw data of the full packet chunk that contained the packet.
+ * @param {bool} injected - Flag if the packet was injected from an Ashita related resource. (Addon, plugin, or internally.)
+ * @param {bool} blocked - Flag if the packet has been blocked by another addon/plugin.
+ * @return {bool} True if handled and should be blocked, false otherwise.
+ *
+ * @notes
+ *
+ *      Only invoked if Ashita::PluginFlags::UsePackets flag is set.
+ *
+ *      If a plugin returns true, the block flag is set to true (cannot be unset), however the event will still be passed to all loaded
+ *      plugins whom are marked to accept it. Plugins should check if the blocked flag has been set first before reacting to the event
+ *      in case a previous plugin has deemed it to be blocked. Unless your plugin requires reacting to certain/all packets, then it
+ *      should simply return immediately if blocked is already true.
+ *
+ *      Packets in FFXI are sent in chunks, meaning there are multiple packets inside of each chunk. This information may be needed when
+ *      dealing with certain packet ids, thus Ashita offers the ability to see the full chunk each packet was part of.
+ *
+ *      id, size, and data are all specific to the individual packet that caused the event to be invoked and contain the unmodified
+ *      information about the individual packet. These should not be edited.
+ *
+ *      modified should be used to determine if changes have been made to the packet by Ashita or another addon/plugin. By default,
+ *      modified is a direct copy of the original packet data.
+ *
+ *      sizeChunk and dataChunk hold the data of the entire chunk the packet was part of that is being processed in the event. These can
+ *      be useful for plugins that may need to look at other packets in the chunk that relate to the current packet of the event. These
+ *      should not be edited.
+ */
+bool Stockpile::HandleIncomingPacket(uint16_t id, uint32_t size, const uint8_t* data, uint8_t* modified, uint32_t sizeChunk, const uint8_t* dataChunk, bool injected, bool blocked)
+{
+    UNREFERENCED_PARAMETER(modified);
+    UNREFERENCED_PARAMETER(sizeChunk);
+    UNREFERENCED_PARAMETER(dataChunk);
+    UNREFERENCED_PARAMETER(blocked);
+
+    if (capture.IsOpen())
+    {
+        capture.Write({ Microseconds(), Capture::Incoming, uint8_t(injected), id, uint16_t(size), data });
+    }
+
+    // THE CURRENT TARGET AND MOBS ATTACKING US ARE OF INTEREST, THE HANDLERS FILTER
+    if (!running || entity == nullptr)
+    {
+        return false;
+    }
+
+    AllocationScope scope(Subsystem::Packets);
+
+    DispatchIncomingPacket(id, size, data);
+
+    return false;
+}
+
+/**
+ * Event invoked when the game client is processing an outgoing packet.
+ *
+ * @param {uint16_t} id - The id of the packet.
+ * @param {uint32_t} size - The size of the packet.
+ * @param {const uint8_t*} data - The raw data of the packet.
+ * @param {uint8_t*} modified - The modified packet data, if any, that has been altered by another addon/plugin.
+ * @param {uint32_t} sizeChunk - The size of the full packet chunk that contained the packet.
+ * @param {const uint8_t*} dataChunk - The raw data of the full packet chunk that contained the packet.
+ * @param {bool} injected - Flag if the packet was injected from an Ashita related resource. (Addon, plugin, or internally.)
+ * @param {bool} blocked - Flag if the packet has been blocked by another addon/plugin.
+ * @return {bool} True if handled and should be blocked, false otherwise.
+ *
+ * @notes
+ *
+ *      Only invoked if Ashita::PluginFlags::UsePackets flag is set.
+ *
+ *      If a plugin returns true, the block flag is set to true (cannot be unset), however the event will still be passed to all loaded
+ *      plugins whom are marked to accept it. Plugins should check if the blocked flag has been set first before reacting to the event
+ *      in case a previous plugin has deemed it to be blocked. Unless your plugin requires reacting to certain/all packets, then it
+ *      should simply return immediately if blocked is already true.
+ *
+ *      Packets in FFXI are sent in chunks, meaning there are multiple packets inside of each chunk. This information may be needed when
+ *      dealing with certain packet ids, thus Ashita offers the ability to see the full chunk each packet was part of.
+ *
+ *      id, size, and data are all specific to the individual packet that caused the event to be invoked and contain the unmodified
+ *      information about the individual packet. These should not be edited.
+ *
+ *      modified should be used to determine if changes have been made to the packet by Ashita or another addon/plugin. By default,
+ *      modified is a direct copy of the original packet data.
+ *
+ *      sizeChunk and dataChunk hold the data of the entire chunk the packet was part of that is being processed in the event. These can
+ *      be useful for plugins that may need to look at other packets in the chunk that relate to the current packet of the event. These
+ *      should not be edited.
+ */
+bool Stockpile::HandleOutgoingPacket(uint16_t id, uint32_t size, const uint8_t* data, uint8_t* modified, uint32_t sizeChunk, const uint8_t* dataChunk, bool injected, bool blocked)
+{
+    UNREFERENCED_PARAMETER(modified);
+    UNREFERENCED_PARAMETER(sizeChunk);
+    UNREFERENCED_PARAMETER(dataChunk);
+    UNREFERENCED_PARAMETER(blocked);
+
+    if (capture.IsOpen())
+    {
+        capture.Write({ Microseconds(), Capture::Outgoing, uint8_t(injected), id, uint16_t(size), data });
+    }
+
+    // ONLY WHAT THE CLIENT SENDS ON ITS OWN, OUR INJECTED PACKETS ARE TRACED WHEN QUEUED
+    if (!running || injected)
+    {
+        return false;
+    }
+
+    DispatchOutgoingPacket(id, size, data);
+
+    return false;
+}
+
+/**
+ * Event invoked when the plugin is being initialized for Direct3D usage.
+ *
+ * @param {IDirect3DDevice8*} device - The Direct3D8 device object.
+ * @return {bool} True on success, false otherwise.
+ *
+ * @notes
+ *
+ *      Only invoked if Ashita::PluginFlags::UseDirect3D flag is set.
+ *
+ *      Plugins must return true from this function in order to be considered valid and continue to load if they do use Direct3D features.
+ *
+ *      If your plugin fails to meet any Direct3D requirements you feel are manditory for it to run, you should return false here and
+ *      prevent it from loading further.
+ */
+bool Stockpile::Direct3DInitialize(IDirect3DDevice8* device)
+{
+    this->m_Direct3DDevice = device;
+
+    // STYLE IS ONLY APPLIED ONCE, NOT PER FRAME
+    if (custom_style)
+    {
+        ApplyStyle();
+    }
+
+    return true;
+}
+
+/**
+ * Applies Ashita's current default styling. (~60 colour entries, so this must not run per frame.)
+ */
+void Stockpile::ApplyStyle()
+{
+    const auto& imgui = m_AshitaCore->GetGuiManager();
+
+    auto& style = imgui->GetStyle();
+    style.ChildRounding = 0.0f;
+    style.FrameBorderSize = 1.0f;
+    style.FramePadding = ImVec2(4.0f, 3.0f);
+    style.FrameRounding = 0.0f;
+    style.GrabRounding = 0.0f;
+    style.ItemSpacing = ImVec2(8.0f, 4.0f);
+    style.ItemInnerSpacing = ImVec2(4.0f, 4.0f);
+    style.TabBorderSize = 1.0f;
+    style.TabRounding = 0.0f;
+    style.ScrollbarRounding = 0.0f;
+    style.WindowBorderSize = 1.0f;
+    style.WindowPadding = ImVec2(8.0f, 8.0f);
+    style.WindowRounding = 2.0f;
+
+    const auto colors = style.Colors;
+    colors[ImGuiCol_Text] = ImVec4(0.94f, 0.94f, 0.94f, 1.00f);
+    colors[ImGuiCol_TextDisabled] = ImVec4(0.94f, 0.94f, 0.94f, 0.29f);
+    colors[ImGuiCol_WindowBg] = ImVec4(0.18f, 0.20f, 0.23f, 0.96f);
+    colors[ImGuiCol_ChildBg] = ImVec4(0.22f, 0.24f, 0.27f, 0.96f);
+    colors[ImGuiCol_PopupBg] = ImVec4(0.05f, 0.05f, 0.10f, 0.90f);
+    colors[ImGuiCol_Border] = ImVec4(0.05f, 0.05f, 0.10f, 0.80f);
+    colors[ImGuiCol_BorderShadow] = ImVec4(0.00f, 0.00f, 0.00f, 0.00f);
+    colors[ImGuiCol_FrameBg] = ImVec4(0.16f, 0.17f, 0.20f, 1.00f);
+    colors[ImGuiCol_FrameBgHovered] = ImVec4(0.14f, 0.14f, 0.14f, 0.78f);
+    colors[ImGuiCol_FrameBgActive] = ImVec4(0.12f, 0.12f, 0.12f, 1.00f);
+    colors[ImGuiCol_TitleBg] = ImVec4(0.83f, 0.33f, 0.28f, 0.69f);
+    colors[ImGuiCol_TitleBgActive] = ImVec4(0.83f, 0.33f, 0.28f, 1.00f);
+    colors[ImGuiCol_TitleBgCollapsed] = ImVec4(0.83f, 0.33f, 0.28f, 0.50f);
+    colors[ImGuiCol_MenuBarBg] = ImVec4(0.12f, 0.13f, 0.17f, 1.00f);
+    colors[ImGuiCol_ScrollbarBg] = ImVec4(0.12f, 0.13f, 0.17f, 1.00f);
+    colors[ImGuiCol_ScrollbarGrab] = ImVec4(0.83f, 0.33f, 0.28f, 0.69f);
+    colors[ImGuiCol_ScrollbarGrabHovered] = ImVec4(0.83f, 0.33f, 0.28f, 1.00f);
+    colors[ImGuiCol_ScrollbarGrabActive] = ImVec4(0.83f, 0.33f, 0.28f, 1.00f);
+    colors[ImGuiCol_CheckMark] = ImVec4(0.83f, 0.33f, 0.28f, 1.00f);
+    colors[ImGuiCol_SliderGrab] = ImVec4(0.83f, 0.33f, 0.28f, 0.69f);
+    colors[ImGuiCol_SliderGrabActive] = ImVec4(0.83f, 0.33f, 0.28f, 1.00f);
+    colors[ImGuiCol_Button] = ImVec4(0.83f, 0.33f, 0.28f, 0.78f);
+    colors[ImGuiCol_ButtonHovered] = ImVec4(0.83f, 0.33f, 0.28f, 1.00f);
+    colors[ImGuiCol_ButtonActive] = ImVec4(0.83f, 0.33f, 0.28f, 1.00f);
+    colors[ImGuiCol_Header] = ImVec4(0.83f, 0.33f, 0.28f, 0.78f);
+    colors[ImGuiCol_HeaderHovered] = ImVec4(0.83f, 0.33f, 0.28f, 1.00f);
+    colors[ImGuiCol_HeaderActive] = ImVec4(0.83f, 0.33f, 0.28f, 1.00f);
+    colors[ImGuiCol_Separator] = ImVec4(0.43f, 0.43f, 0.50f, 0.50f);
+    colors[ImGuiCol_SeparatorHovered] = ImVec4(0.10f, 0.40f, 0.75f, 0.78f);
+    colors[ImGuiCol_SeparatorActive] = ImVec4(0.10f, 0.40f, 0.75f, 1.00f);
+    colors[ImGuiCol_ResizeGrip] = ImVec4(0.05f, 0.05f, 0.05f, 0.69f);
+    colors[ImGuiCol_ResizeGripHovered] = ImVec4(0.83f, 0.33f, 0.28f, 1.00f);
+    colors[ImGuiCol_ResizeGripActive] = ImVec4(0.83f, 0.33f, 0.28f, 1.00f);
+    colors[ImGuiCol_Tab] = ImVec4(0.05f, 0.05f, 0.05f, 0.69f);
+    colors[ImGuiCol_TabHovered] = ImVec4(0.83f, 0.33f, 0.28f, 1.00f);
+    colors[ImGuiCol_TabActive] = ImVec4(0.83f, 0.33f, 0.28f, 1.00f);
+    colors[ImGuiCol_PlotLines] = ImVec4(0.83f, 0.33f, 0.28f, 1.00f);
+    colors[ImGuiCol_PlotLinesHovered] = ImVec4(0.81f, 0.81f, 0.81f, 1.00f);
+    colors[ImGuiCol_PlotHistogram] = ImVec4(0.83f, 0.33f, 0.28f, 1.00f);
+    colors[ImGuiCol_PlotHistogramHovered] = ImVec4(0.81f, 0.81f, 0.81f, 1.00f);
+    colors[ImGuiCol_TableHeaderBg] = ImVec4(0.05f, 0.05f, 0.05f, 0.69f);
+    colors[ImGuiCol_TableBorderStrong] = ImVec4(0.10f, 0.10f, 0.10f, 1.00f);
+    colors[ImGuiCol_TableBorderLight] = ImVec4(0.15f, 0.15f, 0.15f, 1.00f);
+    colors[ImGuiCol_TextSelectedBg] = ImVec4(0.83f, 0.33f, 0.28f, 0.50f);
+    colors[ImGuiCol_DragDropTarget] = ImVec4(1.00f, 1.00f, 0.00f, 0.90f);
+    colors[ImGuiCol_NavHighlight] = ImVec4(1.00f, 1.00f, 0.00f, 1.00f);
+    colors[ImGuiCol_NavWindowingHighlight] = ImVec4(0.83f, 0.33f, 0.28f, 1.00f);
+    colors[ImGuiCol_NavWindowingDimBg] = ImVec4(0.00f, 0.00f, 0.00f, 0.60f);
+    colors[ImGuiCol_ModalWindowDimBg] = ImVec4(0.05f, 0.05f, 0.05f, 0.78f);
+}
+
+/**
+ * Event invoked when the Direct3D device is beginning a scene.
+ *
+ * @param {bool} isRenderingBackBuffer - Flag set if the scene is being rendered to the back buffer.
+ *
+ * @notes
+ *
+ *      Only invoked if Ashita::PluginFlags::UseDirect3D flag is set.
+ *
+ *      This event is invoked before the actual IDirect3DDevice8::BeginScene call is invoked.
+ *
+ *      Multiple scenes can be rendered each frame, thus the isRenderingBackBuffer flag is available to determine when the scene is being
+ *      rendered to the back buffer render target. (Previous Ashita versions only invoked this event when this flag would be true.)
+ */
+void Stockpile::Direct3DBeginScene(bool isRenderingBackBuffer)
+{
+    UNREFERENCED_PARAMETER(isRenderingBackBuffer);
+
+    if (isRenderingBackBuffer)
+    {
+        // PLAYER
+        player_id = this->m_AshitaCore->GetMemoryManager()->GetParty()->GetMemberTargetIndex(0);
+
+        // ENTITY
+        entity = this->m_AshitaCore->GetMemoryManager()->GetEntity();
+
+        // TIME (THE ONLY CLOCK READ THIS FRAME)
+        tick_ms = Milliseconds();
+
+        // TRANSIENT STRINGS FROM THE LAST FRAME ARE DEAD NOW
+        tick_arena.Reset();
+
+        if (auto_pathing)
+        {
+            AllocationScope scope(Subsystem::Pathing);
+
+            Pos pos_new{};
+
+            pos_new.x = entity->GetLocalPositionX(player_id);
+            pos_new.y = entity->GetLocalPositionY(player_id);
+            pos_new.z = entity->GetLocalPositionZ(player_id);
+
+            if (distance(pos_old, pos_new) >= range_auto_pathing)
+            {
+                auto_pathing_positions.push_back(pos_new);
+                pos_old = pos_new;
+                path_dirty = true;
+            }
+        }
+
+        // ZONE CHANGE
+        if (zone_id != this->m_AshitaCore->GetMemoryManager()->GetParty()->GetMemberZone(0))
+        {
+            claims.ReleaseAll();
+            ZoneReset();
+            LoadMobDatData();
+            zone_id = this->m_AshitaCore->GetMemoryManager()->GetParty()->GetMemberZone(0);
+            NavLoad(zone_id);
+        }
+
+        NavPoll();
+
+        claims.Heartbeat(tick_ms);
+
+        // CHECK IF BOT IS RUNNING
+        if (running)
+        {
+            // RESET TARGETED
+            targeted_name = "No Valid Target";
+
+            // TARGET
+            target = this->m_AshitaCore->GetMemoryManager()->GetTarget();
+
+            // IDS
+            targeted_id = target->GetTargetIndex(target->GetIsSubTargetActive() ? 1 : 0);
+
+            // BOOLS
+            has_lock = target->GetLockedOnFlags() & 0x01;
+            has_target = targeted_id != 0;
+            is_player_dead = entity->GetStatus(player_id) == 2 || entity->GetStatus(player_id) == 3;
+
+            if (has_target)
+            {
+                targeted_name = entity->GetName(targeted_id);
+            }
+
+            // ENTITY CHANGES
+            {
+                AllocationScope scope(Subsystem::Entities);
+
+                UpdateEntities();
+                ApplyChatEvents();
+                TraceReactions();
+            }
+        }
+
+        // APPLY WHAT THE WORKER DECIDED FROM EARLIER SNAPSHOTS
+        {
+            AllocationScope scope(Subsystem::Targeting);
+
+            ApplyDecisions();
+        }
+
+        if (running && !is_player_dead)
+        {
+            {
+                AllocationScope scope(Subsystem::Controls);
+
+                Controls();
+            }
+
+            {
+                AllocationScope scope(Subsystem::Actions);
+
+                FlushActions();
+            }
+        }
+
+        UpdateMetrics();
+
+        // HAND THIS FRAME TO THE WORKER
+        PublishSnapshot();
+
+        CheckAllocations();
+    }
+}
+
+/**
+ * Decides targeting and pathing for a snapshot. (Worker thread.)
+ *
+ * Everything read comes from the snapshot and everything the render thread has to do is written to the decision,
+ * the only shared state touched here is the claim table, which is lock-free.
+ *
+ * Only the current state's tick runs. A tick that hands over to another state leaves the decision to it, and the
+ * next state runs in the same decision, so a transition never drops the held keys for a frame.
+ *
+ * @return {bool} True if the decision should be queued, false if there is nothing to apply.
+ */
+bool Stockpile::Decide(const Snapshot& s, Decision& decision)
+{
+    decision.sequence = s.sequence;
+    decision.snapshot_ms = s.tick_ms;
+
+    timers.Advance(s.tick_ms, [&](uint32_t event) { OnTimer(event, decision); });
+
+    // THE CHAT SAID THE TARGET IS OUT OF REACH, CLOSE IN FOR A MOMENT
+    if (s.out_of_range_count != worker_out_of_range_count)
+    {
+        worker_out_of_range_count = s.out_of_range_count;
+        close_in = true;
+        timers.Schedule(TimerCloseIn, 1000);
+    }
+
+    // STOPPED OR ZONED, START OVER
+    if (!s.running || s.zone_id != worker_zone_id)
+    {
+        worker_zone_id = s.zone_id;
+        Enter(BotState::Idle);
+    }
+    else if (s.is_player_dead)
+    {
+        Enter(BotState::Recover);
+    }
+    else
+    {
+        Retarget(s);
+    }
+
+    // EVERY STATE CAN HAND OVER AT MOST ONCE IN A ROW, THE BOUND ONLY GUARDS AGAINST A CYCLE
+    for (size_t n = 0; n < size_t(BotState::Count); n++)
+    {
+        const BotState next = (this->*state_ticks[size_t(bot_state)])(s, decision);
+
+        if (next == bot_state)
+        {
+            break;
+        }
+
+        Enter(next);
+    }
+
+    decision.state = bot_state;
+    decision.closest_target_id = closest_target_id;
+    decision.next_target_id = next_target_id;
+
+    if (bot_state == BotState::Idle || bot_state == BotState::Recover)
+    {
+        return decision.commands != 0;
+    }
+
+    return true;
+}
+
+/**
+ * Syncs the aggro queue, follows whatever the player has targeted and drops targets and next targets a packet
+ * invalidated, before the state runs.
+ */
+void Stockpile::Retarget(const Snapshot& s)
+{
+    // MOBS ATTACKING US, CLOSEST FIRST
+    aggro.Retain([&](uint32_t index) { return s.entities.IsAggro(index); });
+
+    s.entities.ForEachAggro([&](uint32_t index)
+    {
+        const EntityTracker::Entry& e = s.entities.Get(index);
+
+        aggro.Push(uint16_t(index), distance(s.player, Pos{ e.x, e.y, e.z }));
+    });
+
+    // PATH CHANGED, FIND THE CLOSEST NODE AGAIN
+    if (s.path_version != worker_path_version)
+    {
+        closest_path_id = -1;
+        worker_path_version = s.path_version;
+    }
+
+    // ATTACK IF ATTACKED (ONLY MOBS, UNLESS A PACKET ALREADY SHOWED IT DEAD)
+    if (s.has_target && s.targeted_id != s.player_id && uint32_t(s.targeted_id) < EntityTracker::Count && s.entities.Get(s.targeted_id).spawn_flags == 0x10 && !(s.invalidated.index == s.targeted_id && !s.entities.IsStale(s.invalidated)))
+    {
+        if (closest_target_id != s.targeted_id)
+        {
+            closest_target_handle = s.entities.MakeHandle(s.targeted_id);
+        }
+
+        closest_target_id = s.targeted_id;
+    }
+
+    // A PACKET INVALIDATED THE TARGET SINCE IT WAS PICKED
+    if (closest_target_id != -1 && closest_target_handle.index == s.invalidated.index && closest_target_handle.generation == s.invalidated.generation)
+    {
+        claims.Release(s.zone_id, closest_target_id);
+        closest_target_id = -1;
+    }
+
+    // OR THE NEXT ONE
+    if (next_target_id != -1 && next_target_handle.index == s.invalidated_next.index && next_target_handle.generation == s.invalidated_next.generation)
+    {
+        next_target_id = -1;
+    }
+
+    const bool chasing = bot_state == BotState::Approach || bot_state == BotState::Engage || bot_state == BotState::Fight;
+
+    if (closest_target_id != -1 && !chasing)
+    {
+        Enter(BotState::Approach);
+    }
+    else if (closest_target_id == -1 && chasing)
+    {
+        Enter(BotState::Acquire);
+    }
+}
+
+/**
+ * Picks the closest live, selected mob that no sibling instance has reserved and makes it the closest target.
+ *
+ * @return {bool} True if a new target was found, false otherwise.
+ */
+bool Stockpile::AcquireTarget(const Snapshot& s)
+{
+    closest_target_id = -1;
+
+    float distance_target = FLT_MAX;
+
+    // ONLY LIVE, SELECTED MOBS ARE MARKED
+    s.entities.ForEachMarked([&](uint32_t index)
+    {
+        const EntityTracker::Entry& e = s.entities.Get(index);
+
+        float entity_distance = distance(s.player, Pos{ e.x, e.y, e.z });
+
+        // SKIP MOBS A SIBLING INSTANCE HAS RESERVED
+        if (entity_distance <= s.settings.range_new_target && entity_distance < distance_target && sqrt(abs(s.player.z - e.z)) < s.settings.tolerance_z && !claims.IsReserved(s.zone_id, index, s.tick_ms))
+        {
+            distance_target = entity_distance;
+            closest_target_id = int(index);
+        }
+    });
+
+    if (closest_target_id == -1)
+    {
+        return false;
+    }
+
+    PickTarget(s, closest_target_id);
+
+    return true;
+}
+
+/**
+ * Pops the closest mob attacking the player that is still worth fighting and makes it the closest target. Popped
+ * mobs that are not are skipped, they are pushed back on the next sync if they are still aggro.
+ *
+ * @return {bool} True if a new target was found, false if the queue had none.
+ */
+bool Stockpile::AcquireAggro(const Snapshot& s)
+{
+    for (int index = aggro.Pop(); index != -1; index = aggro.Pop())
+    {
+        if (!IsViable(s, index))
+        {
+            continue;
+        }
+
+        closest_target_id = index;
+        PickTarget(s, index);
+
+        return true;
+    }
+
+    return false;
+}
+
+/**
+ * Takes the target picked while fighting the last one, without scanning. It has been settling since it was picked,
+ * so it is selected as soon as it is in range instead of waiting out the settle time again.
+ *
+ * @return {bool} True if the next target was still valid and taken, false otherwise.
+ */
+bool Stockpile::AcquireNext(const Snapshot& s)
+{
+    const int index = next_target_id;
+    const uint64_t picked_ms = next_target_ms;
+
+    next_target_id = -1;
+
+    if (index == -1 || index == closest_target_handle.index || s.entities.IsStale(next_target_handle) || !IsViable(s, index))
+    {
+        return false;
+    }
+
+    closest_target_id = index;
+    PickTarget(s, index);
+
+    if (s.tick_ms >= picked_ms + 5000)
+    {
+        target_settled = true;
+        timers.Cancel(timer_target_settled);
+    }
+
+    return true;
+}
+
+/**
+ * Keeps the next target current while fighting: the closest viable mob attacking the player, else the closest
+ * selected mob. A pick that is still viable is kept unless an attacker shows up, so it keeps settling.
+ */
+void Stockpile::PlanNext(const Snapshot& s)
+{
+    const bool keep = next_target_id != -1 && next_target_id != closest_target_id && !s.entities.IsStale(next_target_handle) && IsViable(s, next_target_id);
+
+    if (keep && s.entities.IsAggro(next_target_id))
+    {
+        return;
+    }
+
+    int best = -1;
+    float distance_best = FLT_MAX;
+
+    auto consider = [&](uint32_t index)
+    {
+        if (int(index) == closest_target_id || !IsViable(s, int(index)))
+        {
+            return;
+        }
+
+        const EntityTracker::Entry& e = s.entities.Get(index);
+
+        float entity_distance = distance(s.player, Pos{ e.x, e.y, e.z });
+
+        if (entity_distance < distance_best)
+        {
+            distance_best = entity_distance;
+            best = int(index);
+        }
+    };
+
+    s.entities.ForEachAggro(consider);
+
+    // NO ATTACKERS, KEEP THE PICK OR FALL BACK TO THE CLOSEST SELECTED MOB
+    if (best == -1)
+    {
+        if (keep)
+        {
+            return;
+        }
+
+        s.entities.ForEachMarked([&](uint32_t index)
+        {
+            if (sqrt(abs(s.player.z - s.entities.Get(index).z)) < s.settings.tolerance_z)
+            {
+                consider(index);
+            }
+        });
+    }
+
+    if (best != next_target_id)
+    {
+        next_target_id = best;
+        next_target_handle = s.entities.MakeHandle(best);
+        next_target_ms = s.tick_ms;
+    }
+}
+
+/**
+ * @return {bool} True if the slot is a live mob in range, not claimed by anyone else, not reserved by a sibling and
+ * not invalidated by a packet.
+ */
+bool Stockpile::IsViable(const Snapshot& s, int index)
+{
+    const EntityTracker::Entry& e = s.entities.Get(index);
+
+    bool invalidated = (s.invalidated.index == index && !s.entities.IsStale(s.invalidated)) || (s.invalidated_next.index == index && !s.entities.IsStale(s.invalidated_next));
+    bool claimed = e.claim_id == s.player_server_id || e.claim_id == 0;
+
+    if (invalidated || !claimed || !e.present || e.hp == 0 || e.status == 2 || e.status == 3)
+    {
+        return false;
+    }
+
+    return distance(s.player, Pos{ e.x, e.y, e.z }) <= s.settings.range_new_target && !claims.IsReserved(s.zone_id, index, s.tick_ms);
+}
+
+/**
+ * Makes a slot the closest target: takes its handle, settles before selecting and publishes the intent.
+ */
+void Stockpile::PickTarget(const Snapshot& s, int index)
+{
+    closest_path_id = -1;
+    closest_target_handle = s.entities.MakeHandle(index);
+    steering.Reset();
+
+    // SETTLE BEFORE SELECTING
+    target_settled = false;
+    timers.Cancel(timer_target_settled);
+    timer_target_settled = timers.Schedule(TimerTargetSettled, 5000);
+
+    claims.Reserve(s.zone_id, index, ClaimTable::Intent, s.tick_ms);
+}
+
+/**
+ * Invoked by the timer wheel when a scheduled event fires.
+ */
+void Stockpile::OnTimer(uint32_t event, Decision& decision)
+{
+    switch (event)
+    {
+    case TimerAttackReady:
+        attack_ready = true;
+        break;
+    case TimerSelectReady:
+        select_ready = true;
+        break;
+    case TimerTargetSettled:
+        target_settled = true;
+        break;
+    case TimerEscapeRelease:
+        decision.commands |= CommandEscapeUp;
+        escape_down = false;
+        break;
+    case TimerCloseIn:
+        close_in = false;
+        break;
+    default:
+        break;
+    }
+}
+
+float Stockpile::GetHeadingDifference(const Snapshot& s, float x2, float y2)
+{
+    // TARGET DATA
+    float h1 = s.player_heading;
+    float x1 = s.player.x;
+    float y1 = s.player.y;
+
+    float radians = atan2(-(y2 - y1), x2 - x1);
+
+    float difference = radians - h1;
+    float pi = float(M_PI);
+
+    if (difference < -pi)
+    {
+        difference = difference + 2 * pi;
+    }
+
+    if (difference > pi)
+    {
+        difference = difference - 2 * pi;
+    }
+
+    return difference;
+}
+
+/**
+ * Forgets the current target and path node. (Worker thread, when stopped or zoned.)
+ *
+ * A pending escape release is left to fire, so the key is not left held.
+ */
+void Stockpile::ResetDecisions()
+{
+    closest_target_id = -1;
+    closest_target_handle = {};
+    closest_path_id = -1;
+    steering.Reset();
+    aggro.Clear();
+    next_target_id = -1;
+    next_target_handle = {};
+
+    attack_ready = true;
+    select_ready = true;
+    target_settled = false;
+    close_in = false;
+    timers.Cancel(timer_target_settled);
+}
+
+/**
+ * Drops the previous zone's context and releases its arena as a whole. (Render thread, on zone change.)
+ */
+void Stockpile::ZoneReset()
+{
+    zone_context.reset();
+    zone_arena.Release();
+    zone_context.emplace(&zone_arena);
+
+    mobs_names_dirty = true;
+    mobs_filtered_dirty = true;
+}
+
+void Stockpile::LoadMobDatData()
+{
+    char buffer[MAX_PATH]{};
+    if (!Ashita::Registry::GetInstallPath(Ashita::LanguageId::Default, Ashita::SquareEnixGameId::FinalFantasyXI, buffer, MAX_PATH))
+    {
+        Log("Failed to load zone mob data.");
+        return;
+    }
+
+    const auto zone = this->m_AshitaCore->GetMemoryManager()->GetParty()->GetMemberZone(0);
+    if (!ZoneMap.contains(zone))
+    {
+        Log("Failed to locate required map entry.");
+        return;
+    }
+
+    std::filesystem::path path = buffer;
+
+    std::error_code ec{};
+    if (!std::filesystem::exists(path, ec) || ec)
+    {
+        Log("Failed to locate required map DAT file.");
+        return;
+    }
+
+    path += "\\";
+    path += std::get<0>(ZoneMap[zone]);
+
+    Log(std::format("Loading ({}) {}", zone, std::get<1>(ZoneMap[zone])));
+    Log(std::format("Path: {}", path.string()));
+
+    FILE* f = nullptr;
+    if (::fopen_s(&f, path.string().c_str(), "rb") != ERROR_SUCCESS)
+    {
+        Log("Failed to open zone mob list DAT file.");
+        return;
+    }
+
+    ::fseek(f, 0, SEEK_END);
+    const auto size = ::ftell(f);
+    ::fseek(f, 0, SEEK_SET);
+
+    if (size == 0 || (size % 0x20) != 0)
+    {
+        ::fclose(f);
+
+        Log("Mob zone list is invalid / incorrectly sized.");
+        return;
+    }
+
+    // 0000 - 1023 = static zone entities.
+    // 1024 - 1791 = players
+    // 1792 - 2303 = spawnables (pets, summons, dynamic event entities, etc.)
+
+    MobTable& mob_table = zone_context->mob_table;
+
+    // ONE READ, ONE PASS OVER THE RECORDS
+    char* records = mob_table.Prepare(size_t(size));
+    const bool read = ::fread(records, size_t(size), 1, f) == 1;
+
+    ::fclose(f);
+
+    if (!read)
+    {
+        mob_table.Prepare(0);
+
+        Log("Failed to read zone mob list DAT file.");
+        return;
+    }
+
+    mob_table.Index([this](std::string_view name) { return contains_find(mobs_common_bans, name); });
+    mob_table.Classify(mobs_matcher);
+
+    Log(std::format("Mobs: {}", mob_table.Records()));
+    Log(std::format("Mobs Unique: {}", mob_table.NameCount()));
+    Log(std::format("Zone Memory: {} KB used, {} KB resident", zone_arena.Used() / 1024, zone_arena.Resident() / 1024));
+
+    mobs_reclassify = true;
+}
+
+/**
+ * Compiles mobs_selected and mobs_potential_bans into mobs_matcher. Must be called whenever either list changes.
+ */
+void Stockpile::CompileMatcher()
+{
+    if (!mobs_matcher.Compile(mobs_selected, mobs_potential_bans))
+    {
+        Log(std::format("Too many wildcard targets, only the first {} are used.", Matcher::MaxWildcards));
+    }
+
+    zone_context->mob_table.Classify(mobs_matcher);
+
+    mobs_filtered_dirty = true;
+    mobs_reclassify = true;
+}
+
+/**
+ * Copies the zone's unique mob names out of the mob table into unique_names, sorts them and indexes them for the
+ * search. (Only invoked from the Targets panel, a zone load does not build display strings.)
+ */
+void Stockpile::DecodeNames()
+{
+    ZoneContext& zone = *zone_context;
+
+    zone.unique_names.Reserve(zone.mob_table.NameCount(), zone.mob_table.NameCount() * MobTable::NameSize);
+
+    for (size_t n = 0; n < zone.mob_table.NameCount(); n++)
+    {
+        zone.unique_names.Add(zone.mob_table.NameAt(uint16_t(n)));
+    }
+
+    zone.unique_names.Sort();
+    zone.name_index.Build(zone.unique_names);
+
+    mobs_names_dirty = false;
+    mobs_filtered_dirty = true;
+}
+
+/**
+ * Rebuilds the list of targets shown in the "Available Targets" list box.
+ *
+ * Only invoked when the zone, the search, include_pit or the selection changes, so the potential bans search is not
+ * repeated for every name on every frame. The name index hands back only the names containing the search, the rest
+ * are never looked at.
+ */
+void Stockpile::FilterTargets()
+{
+    ZoneContext& zone = *zone_context;
+
+    const auto start = std::chrono::steady_clock::now();
+
+    zone.filtered.clear();
+    zone.filtered.reserve(zone.unique_names.size());
+
+    zone.name_index.Query(mobs_search_applied, [&](uint32_t n)
+    {
+        if (include_pit || !(mobs_matcher.Classify(zone.unique_names[n]) & Matcher::Banned))
+        {
+            zone.filtered.push_back(int(n));
+        }
+    });
+
+    mobs_search_us = std::chrono::duration<float, std::micro>(std::chrono::steady_clock::now() - start).count();
+    mobs_filtered_dirty = false;
+}
+
+/**
+ * Adds every target the search currently shows to the selection. (Enter in the search box, or Add Matches.)
+ */
+void Stockpile::AddMatches()
+{
+    if (mobs_search_applied[0] == '\0')
+    {
+        return;
+    }
+
+    const ZoneContext& zone = *zone_context;
+    size_t added = 0;
+
+    for (const int n : zone.filtered)
+    {
+        if (!contains_find(mobs_selected, zone.unique_names[n]))
+        {
+            mobs_selected.emplace_back(zone.unique_names[n]);
+            added++;
+        }
+    }
+
+    if (added != 0)
+    {
+        CompileMatcher();
+    }
+
+    Log(std::format("Added {} targets matching: {}", added, mobs_search_applied));
+}
+
+/**
+ * Event invoked when the Direct3D device is ending a scene.
+ *
+ * @param {bool} isRenderingBackBuffer - Flag set if the scene is being rendered to the back buffer.
+ *
+ * @notes
+ *
+ *      Only invoked if Ashita::PluginFlags::UseDirect3D flag is set.
+ *
+ *      This event is invoked before the actual IDirect3DDevice8::EndScene call is invoked.
+ *
+ *      Multiple scenes can be rendered each frame, thus the isRenderingBackBuffer flag is available to determine when the scene is being
+ *      rendered to the back buffer render target. (Previous Ashita versions only invoked this event when this flag would be true.)
+ */
+void Stockpile::Direct3DEndScene(bool isRenderingBackBuffer)
+{
+    UNREFERENCED_PARAMETER(isRenderingBackBuffer);
+}
+
+/**
+ * Event invoked when the Direct3D device is presenting a scene.
+ *
+ * @param {const RECT*} pSourceRect - The source rect being presented.
+ * @param {const RECT*} pDestRect - The destination rect being presented into.
+ * @param {HWND} hDestWindowOverride - The override window handle to present into.
+ * @param {const RGNDATA*} pDirtyRegion - The present dirty regions.
+ *
+ * @notes
+ *
+ *      Only invoked if Ashita::PluginFlags::UseDirect3D flag is set.
+ *
+ *      This event is invoked before the actual IDirect3DDevice8::Present call is invoked.
+ *
+ *      For best results of custom Direct3D rendering, it is best to do your own custom drawing here to draw over-top of all game related
+ *      scenes and objects. Usage of ImGui should be done here as well.
+ */
+void Stockpile::Direct3DPresent(const RECT* pSourceRect, const RECT* pDestRect, HWND hDestWindowOverride, const RGNDATA* pDirtyRegion)
+{
+    UNREFERENCED_PARAMETER(pSourceRect);
+    UNREFERENCED_PARAMETER(pDestRect);
+    UNREFERENCED_PARAMETER(hDestWindowOverride);
+    UNREFERENCED_PARAMETER(pDirtyRegion);
+
+    AllocationScope scope(Subsystem::Gui);
+
+    // GUI START
+    const auto& imgui = m_AshitaCore->GetGuiManager();
+
+    imgui->SetNextWindowSize(ImVec2(0, 0), ImGuiCond_Always); // SIZE OF GUI
+
+    // COLLAPSED, NOTHING ELSE IS BUILT
+    if (!imgui->Begin(this->window_title)) {
+        imgui->End();
+        return;
+    }
+
+    // GUI PADDING
+    imgui->PushStyleVar(ImGuiStyleVar_FramePadding, ImVec2(6, 6));
+
+    // ADD GUI ELEMENTS...
+    if (imgui->Button("Start Bot", ImVec2(150, 27))) {
+        running = true;
+        mobs_reclassify = true;
+        auto_pathing = false;
+    }
+
+    imgui->SameLine();
+
+    if (imgui->Button("Stop Bot", ImVec2(150, 27))) {
+        actions.Clear();
+
+        // ENGAGED, STOP FIGHTING TOO, WHATEVER THE PLAYER IS FIGHTING (THE WORKER'S PICK IS GONE AFTER AN INVALIDATION)
+        if (entity != nullptr && entity->GetStatus(player_id) == 1)
+        {
+            const int battle_target = entity->GetTargetedIndex(player_id);
+
+            QueueAction(Action::Disengage, battle_target != 0 ? battle_target : targeted_id != 0 ? targeted_id : decided.closest_target_id);
+        }
+
+        running = false;
+        claims.ReleaseAll();
+        Stockpile::ControlsReload();
+    }
+
+    char buff[256]{};
+
+    imgui->TextColored(running ? green : red, "%s", label_running.Get(running));
+
+    if (imgui->CollapsingHeader("Status's"))
+    {
+        imgui->TextColored(has_target ? green : red, "%s", label_has_target.Get(has_target));
+        imgui->TextColored(has_lock ? green : red, "%s", label_has_lock.Get(has_lock));
+        imgui->TextUnformatted(label_closest_target_name.Get(closest_target_name));
+        imgui->TextColored(decided.closest_target_id != -1 ? green : red, "%s", label_closest_target_id.Get(decided.closest_target_id));
+        imgui->TextUnformatted(label_closest_target_distance.Get(decided.closest_target_distance));
+        imgui->TextUnformatted(label_next_target_id.Get(decided.next_target_id));
+        imgui->TextUnformatted(label_targeted_name.Get(targeted_name));
+        imgui->TextColored(targeted_id != -1 ? green : red, "%s", label_targeted_id.Get(targeted_id));
+        imgui->TextUnformatted(label_zone_memory.Get(zone_arena.Used() / 1024.0f));
+        imgui->TextUnformatted(label_zone_resident.Get(zone_arena.Resident() / 1024.0f));
+    }
+
+    if (imgui->CollapsingHeader("Session"))
+    {
+        const uint64_t session = metrics.Session();
+
+        imgui->TextUnformatted(label_session.Get(session / 3600000, session / 60000 % 60, session / 1000 % 60));
+        imgui->TextUnformatted(label_kills.Get(metrics.Kills(), metrics.KillsPerHour()));
+        imgui->TextUnformatted(label_retargets.Get(metrics.Retargets()));
+        imgui->TextUnformatted(label_commands.Get(metrics.Commands(), metrics.CommandsPerMinute()));
+        imgui->TextUnformatted(label_decisions_dropped.Get(decisions_dropped.load(std::memory_order_relaxed)));
+
+        FormatSummary();
+
+        for (size_t n = 0; n < Metrics::States; n++)
+        {
+            imgui->TextUnformatted(summary_states[n]);
+        }
+
+        for (size_t n = 0; n < 3; n++)
+        {
+            imgui->TextUnformatted(summary_times[n]);
+        }
+
+        imgui->TextUnformatted("Reaction Latency:");
+
+        for (size_t n = 0; n < size_t(Reaction::Count); n++)
+        {
+            imgui->BulletText("%s", summary_reactions[n]);
+        }
+
+        for (uint32_t n = 0; n < summary_mob_count; n++)
+        {
+            imgui->BulletText("%s", summary_mobs[n]);
+        }
+
+        if (imgui->Button("Export CSV", ImVec2(150, 27))) {
+            ExportMetrics();
+        }
+
+        imgui->SameLine();
+
+        if (imgui->Button("Reset Session", ImVec2(150, 27))) {
+            metrics.Clear();
+        }
+
+        if (imgui->Button(capture.IsOpen() ? "Stop Capture" : "Start Capture", ImVec2(150, 27))) {
+            capture.IsOpen() ? CaptureStop() : CaptureStart();
+        }
+
+        if (capture.IsOpen())
+        {
+            imgui->Text("Capturing: %u packets, %.1f KB", capture.Records(), capture.Bytes() / 1024.0f);
+        }
+    }
+
+    if (imgui->CollapsingHeader("Settings (Tolerance & Range) "))
+    {
+
+        imgui->SliderFloat("Tolerance Yaw", &tolerance_yaw, 0.1f, 0.5f, "%.2f");
+        imgui->SliderFloat("Tolerance Z", &tolerance_z, 0.5f, 20.0f, "%.2f");
+
+        imgui->SliderFloat("Range New Target", &range_new_target, 20.0f, 50.0f, "%.2f");
+        imgui->SliderFloat("Range Engage", &range_engage, 10.0f, 30.0f, "%.2f");
+        imgui->SliderFloat("Range Attacking", &range_attacking, 2.0f, 4.0f, "%.2f");
+        imgui->SliderFloat("Range Minimum", &range_minimum, 1.0f, 2.0f, "%.2f");
+    }
+
+    if (imgui->CollapsingHeader("Targets"))
+    {
+        // MANUAL TARGET
+        imgui->Text("Target Name: (* = Wildcard, Goblin* / *Crab / *Bee* / Orc*Lord)");
+
+        imgui->InputText("", mtarget, IM_ARRAYSIZE(mtarget));
+
+        if (imgui->Button("Add Target", ImVec2(150, 27))) {
+            Log(std::format("Added: {}", mtarget));
+            mobs_selected.push_back(mtarget);
+            CompileMatcher();
+        }
+
+        if (imgui->Checkbox("Include Potentially Invalid Targets", &include_pit))
+        {
+            mobs_filtered_dirty = true;
+        }
+
+        imgui->Text("Double click to add or remove targets.");
+
+        // SEARCH
+        imgui->Text("Search: (Enter adds every match)");
+
+        bool add_matches = imgui->InputText("##search", mobs_search, IM_ARRAYSIZE(mobs_search), ImGuiInputTextFlags_EnterReturnsTrue);
+
+        imgui->SameLine();
+
+        if (imgui->Button("Add Matches")) {
+            add_matches = true;
+        }
+
+        if (::strcmp(mobs_search, mobs_search_applied) != 0)
+        {
+            ::memcpy(mobs_search_applied, mobs_search, sizeof(mobs_search_applied));
+            mobs_filtered_dirty = true;
+        }
+
+        if (mobs_names_dirty)
+        {
+            DecodeNames();
+        }
+
+        if (mobs_filtered_dirty)
+        {
+            FilterTargets();
+        }
+
+        if (add_matches)
+        {
+            AddMatches();
+        }
+
+        imgui->Text("%zu matches (%.1f us)", zone_context->filtered.size(), mobs_search_us);
+
+        if (imgui->ListBoxHeader("Available Targets"))
+        {
+            int first = 0;
+            int last = 0;
+
+            ListClipBegin(int(zone_context->filtered.size()), first, last);
+
+            for (int i = first; i < last; i++)
+            {
+                const int n = zone_context->filtered[i];
+                const bool is_selected = (item_current_idx == n);
+
+                if (imgui->Selectable(zone_context->unique_names[n].data(), is_selected, ImGuiSelectableFlags_AllowDoubleClick))
+                {
+                    item_current_idx = n;
+
+                    if (imgui->IsMouseDoubleClicked(0))
+                    {
+                        if (!contains_find(mobs_selected, zone_context->unique_names[item_current_idx])) {
+                            mobs_selected.emplace_back(zone_context->unique_names[item_current_idx]);
+                            CompileMatcher();
+
+                            Log(std::format("Added: {}", zone_context->unique_names[item_current_idx]));
+                        }
+                    }
+                }
+            }
+
+            ListClipEnd(int(zone_context->filtered.size()), last);
+
+            imgui->ListBoxFooter();
+        }
+
+        int remove = -1;
+
+        if (imgui->ListBoxHeader("Selected Targets"))
+        {
+            for (int n = 0; n < int(mobs_selected.size()); n++)
+            {
+                const bool is_selected = (item_current_idx == n);
+
+                if (imgui->Selectable(mobs_selected[n].c_str(), is_selected, ImGuiSelectableFlags_AllowDoubleClick))
+                {
+                    item_current_idx = n;
+
+                    if (imgui->IsMouseDoubleClicked(0))
+                    {
+                        remove = item_current_idx;
+                    }
+                }
+            }
+            imgui->ListBoxFooter();
+        }
+
+        if (remove != -1) {
+            Log(std::format("Removed: {}", mobs_selected[item_current_idx].c_str()));
+
+            mobs_selected.erase(mobs_selected.begin() + item_current_idx);
+            CompileMatcher();
+            remove = -1;
+        }
+    }
+
+    if (imgui->CollapsingHeader("Pathing"))
+    {
+        if (imgui->Button("Start Auto-Pathing", ImVec2(150, 27))) {
+            auto_pathing = true;
+        }
+
+        imgui->SameLine();
+
+        if (imgui->Button("Stop Auto-Pathing", ImVec2(150, 27))) {
+            auto_pathing = false;
+        }
+
+        imgui->SliderFloat("Distance Auto-Pathing", &range_auto_pathing, 5.0f, 30.0f, "%.1f");
+        imgui->SliderFloat("Range to proccess next node", &range_next_path, 3.0f, 5.0f, "%.1f");
+
+        imgui->TextColored(auto_pathing ? green : red, "%s", label_auto_pathing.Get(auto_pathing));
+
+        int remove = -1;
+
+        if (imgui->ListBoxHeader("Pathing Positions"))
+        {
+            int first = 0;
+            int last = 0;
+
+            ListClipBegin(int(auto_pathing_positions.size()), first, last);
+
+            // ONLY VISIBLE NODES ARE FORMATTED
+            for (int n = first; n < last; n++)
+            {
+                const bool is_selected = (item_current_idx == n);
+
+                Pos p = auto_pathing_positions[n];
+
+                sprintf_s(buff, "[%d] %.1f, %.1f, %.1f", n, p.x, p.y, p.z);
+
+                if (imgui->Selectable(buff, is_selected, ImGuiSelectableFlags_AllowDoubleClick))
+                {
+                    item_current_idx = n;
+
+                    if (imgui->IsMouseDoubleClicked(0))
+                    {
+                        remove = item_current_idx;
+                    }
+                }
+            }
+
+            ListClipEnd(int(auto_pathing_positions.size()), last);
+
+            imgui->ListBoxFooter();
+        }
+
+        if (remove != -1) {
+            Pos p = auto_pathing_positions[item_current_idx];
+
+            Log(std::format("[{}] {:.1f}, {:.1f}, {:.1f}", item_current_idx, p.x, p.y, p.z).c_str());
+
+            auto_pathing_positions.erase(auto_pathing_positions.begin() + item_current_idx);
+            path_dirty = true;
+            remove = -1;
+        }
+
+        if (imgui->Button("Remove All", ImVec2(150, 27))) {
+            running = false;
+            auto_pathing_positions.clear();
+            path_dirty = true;
+        }
+    }
+
+    // GUI POP STYLE VAR
+    imgui->PopStyleVar();
+
+    // GUI END
+    imgui->End();
+
+    // imgui->ShowDemoWindow();
+}
+
+/**
+ * Returns an instance of this plugins main class.
+ *
+ * @param {const char*} args - The arguments passed to the plugin when it was loaded.
+ * @return {IPlugin*} The plugins class object instance.
+ * @notes
+ *
+ *      This export must be present for a plugin to load properly!
+ *
+ *      The args parameter can be used to prepare the plugin in any special manner for specific properties based on the arguments passed.
+ *      For example, if you wish to have a password required to load the plugin, this can be used for that kind of thing. (Not recommended
+ *      as this is a weak form of authentication, just an example.)
+ */
+__declspec(dllexport) IPlugin* __stdcall expCreatePlugin(const char* args)
+{
+    UNREFERENCED_PARAMETER(args);
+
+    return new Stockpile();
+}
+
+/**
+ * Returns the plugins Ashita interface version it was compiled against.
+ *
+ * @return {double} The plugins interface version.
+ * @notes
+ *
+ *      This export must be present for a plugin to load properly!
+ */
+__declspec(dllexport) double __stdcall expGetInterfaceVersion(void)
+{
+    return ASHITA_INTERFACE_VERSION;
+}
+
 #endif // SOCKPILE_H_INCLUDED
\ No newline at end of file
@@ -1,206 +1,562 @@
-#ifndef ASHITA_STOCKPILE_H_INCLUDED
-#define ASHITA_STOCKPILE_H_INCLUDED
-
-#if defined(_MSC_VER) && (_MSC_VER >= 1020)
-#pragma once
-#endif
-
-/**
- * Main Ashita SDK Header
- *
- * This is the main header to include while creating Ashita plugins. This header includes
- * the various interfaces, structures, and enumerations needed for working with Ashita. It
- * also includes the other headers included with the SDK in a single file.
- *
- * Update the path to this file to where you have the latest version of Ashita installed to.
- */
-
-#include "S:\Steam\steamapps\common\FFXINA\SquareEnix\AshitaV4\plugins\sdk\Ashita.h"
-#include "Control.h"
-
-#include <filesystem>
-#include <algorithm>
-#include <fstream>
-#include <format>
-#include <string>
-#include <ctime>
-#include <list>
-#include <map>
-
- /**
-  * Stockpile Class Implementation
-  *
-  * This is the main class object the plugin will create an instance of and return to Ashita when
-  * the 'CreatePlugin' export is called. This class MUST inherit from the 'IPlugin' interface to
-  * work properly with Ashita.
-  */
-class Stockpile final : public IPlugin
-{
-    // ASHITA
-    IAshitaCore* m_AshitaCore;          // The main AshitaCore object pointer.
-    ILogManager* m_LogManager;          // The main LogManager object pointer.
-    IDirect3DDevice8* m_Direct3DDevice; // The main Direct3D device object pointer.
-    uint32_t m_PluginId;                // The plugins id. (It's base address.)
-
-    char window_title[255]{};
-
-    // CONFIG DEFAULTS
-    // Tolerances (Bot)
-    float tolerance_yaw = 0.25f;	    // YAW Tolerance				            0.10 to  0.5 Yalms (Default:  0.20)
-    float tolerance_z = 4.0f;           // Z Tolerance					            0.50 to 20.0 Yalms (Default:  4.00)
-    // Ranges (Bot)
-    float range_new_target = 25.0f;     // Range to choose a new target	           20.00 to 50.0 Yalms (Default: 25.00)
-    float range_engage = 19.0f;	        // Range to engage target		           10.00 to 30.0 Yalms (Default: 17.00)
-    float range_attacking = 2.5f;	    // Range to stop moving			            2.00 to  4.0 Yalms (Default:  2.50)
-    float range_minimum = 1.0f;	        // Range to move backwards		            1.00 to  2.0 Yalms (Default:  1.00)
-    // Ranges (Pathing)
-    float range_next_path = 3.0f;       // Range to process next node on path       5.00 to 20.0 Yalms (Default:  5.00)
-    float range_auto_pathing = 10.0f;   // Range to create a new autopathing node   5.00 to 10.0 Yalms (Default:  5.00)
-
-    // CONFIG STATIC
-    bool debug = true;                  // Sets debug mode. (Default: false)
-
-    // ZONE DATA
-    struct MobDatData
-    {
-        char name[0x1C];
-        long server_id;
-        long target_index;
-        long zone_id;
-    };
-
-    std::vector<MobDatData> mobs;
-    std::vector<std::string> mobs_common_bans = {"???", "", "none", "EFFECTER"};
-    std::vector<std::string> mobs_potential_bans = {",", ".", "#", "Moogle"};
-    std::vector<std::string> mobs_unique_names;
-    std::vector<std::string> mobs_selected;
-
-    struct Pos
-    {
-        float x;
-        float y;
-        float z;
-    };
-
-    std::vector<Pos> auto_pathing_positions;
-    Pos pos_old{};
-
-    int item_current_idx = 0;
-    char mtarget[128]{};
-
-    // CONTROLS
-    std::list<Control> controls
-    {
-        Control("numpad2", false, false),
-        Control("numpad8", false, false),
-        Control("left", false, false),
-        Control("right", false, false),
-    };
-
-    // RUNNING
-    bool running = false;
-    bool auto_pathing = false;
-
-    IEntity* entity;
-    ITarget* target;
-
-    // PLAYER
-    int player_id;
-
-    // IDS
-    int targeted_id = -1;
-    const char* targeted_name = "No Valid Target";
-
-    // BOOLS
-    bool has_lock = false;
-    bool has_target = false;
-    bool is_player_dead = false;
-    bool reverse_path = false;
-
-    // CLOSEST TARGET
-    int closest_target_id = -1;
-    const char* closest_target_name = "No Valid Target";
-    float closest_target_distance = 0;
-
-    // CLOSEST PATH ID
-    int closest_path_id = -1;
-
-    // TIMERS
-    std::chrono::steady_clock::time_point begin_new_attack = std::chrono::steady_clock::now();
-    std::chrono::steady_clock::time_point begin_new_target = std::chrono::steady_clock::now();
-    std::chrono::steady_clock::time_point begin_new_select = std::chrono::steady_clock::now();
-
-    // MOVING
-    float oldx = -1;
-    float oldy = -1;
-
-    bool target_moving = true;
-
-    // ZONE
-    int zone_id = -1;
-
-    // COLORS
-    ImVec4 red      = ImVec4(0.83f, 0.33f, 0.28f, 1.00f);
-    ImVec4 green    = ImVec4(0.33f, 0.83f, 0.28f, 1.00f);
-
-    // BANS
-    bool include_pit;
-
-public:
-    Stockpile(void);
-    ~Stockpile(void);
-
-    // Plugin Information Properties
-    const char* GetName(void) const override;
-    const char* GetAuthor(void) const override;
-    const char* GetDescription(void) const override;
-    const char* GetLink(void) const override;
-    double GetVersion(void) const override;
-    double GetInterfaceVersion(void) const override;
-    int32_t GetPriority(void) const override;
-    uint32_t GetFlags(void) const override;
-
-    // General Methods
-    bool Initialize(IAshitaCore* core, ILogManager* logger, uint32_t id) override;
-    void Release(void) override;
-
-    // Event Callbacks: ChatManager
-    bool HandleCommand(int32_t mode, const char* command, bool injected) override;
-    bool HandleIncomingText(int32_t mode, bool indent, const char* message, int32_t* modifiedMode, bool* modifiedIndent, char* modifiedMessage, bool injected, bool blocked) override;
-
-    // Event Callbacks: PacketManager
-    bool HandleIncomingPacket(uint16_t id, uint32_t size, const uint8_t* data, uint8_t* modified, uint32_t sizeChunk, const uint8_t* dataChunk, bool injected, bool blocked) override;
-    bool HandleOutgoingPacket(uint16_t id, uint32_t size, const uint8_t* data, uint8_t* modified, uint32_t sizeChunk, const uint8_t* dataChunk, bool injected, bool blocked) override;
-
-    // Event Callbacks: Direct3D
-    bool Direct3DInitialize(IDirect3DDevice8* device) override;
-    void Direct3DBeginScene(bool isRenderingBackBuffer) override;
-    void Direct3DEndScene(bool isRenderingBackBuffer) override;
-    void Direct3DPresent(const RECT* pSourceRect, const RECT* pDestRect, HWND hDestWindowOverride, const RGNDATA* pDirtyRegion) override;
-
-    // Helpers.cpp
-    void Log(const std::string& str);
-    void QueueCommand(int32_t, const std::string& str);
-    int RandomFV(int factor, int var);
-    int RandomA(int factor);
-    int Random(int min, int max);
-    void ltrim(std::string& s);
-    void rtrim(std::string & s);
-    void trim(std::string & s);
-    bool contains_find(std::vector<std::string> vec, std::string search);
-    bool contains_search(std::vector<std::string> vec, std::string search);
-    float distance(Pos p1, Pos p2);
-
-    // Control.cpp
-    void ControlsReload();
-    void ControlsReset();
-    void ControlsDown(std::string control);
-    void Controls();
-
-    float GetHeadingDifference(float x2, float y2);
-
-    // DATS
-    void LoadMobDatData();
-};
-
+#ifndef ASHITA_STOCKPILE_H_INCLUDED
+#define ASHITA_STOCKPILE_H_INCLUDED
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+/**
+ * Main Ashita SDK Header
+ *
+ * This is the main header to include while creating Ashita plugins. This header includes
+ * the various interfaces, structures, and enumerations needed for working with Ashita. It
+ * also includes the other headers included with the SDK in a single file.
+ *
+ * Update the path to this file to where you have the latest version of Ashita installed to.
+ */
+
+#include "S:\Steam\steamapps\common\FFXINA\SquareEnix\AshitaV4\plugins\sdk\Ashita.h"
+#include "Actions.h"
+#include "AggroQueue.h"
+#include "BotState.h"
+#include "Allocations.h"
+#include "ChatClassifier.h"
+#include "ClaimTable.h"
+#include "Control.h"
+#include "EntityTracker.h"
+#include "Label.h"
+#include "Matcher.h"
+#include "Metrics.h"
+#include "MobTable.h"
+#include "NavGrid.h"
+#include "TimerWheel.h"
+#include "NameArena.h"
+#include "NameIndex.h"
+#include "PacketCapture.h"
+#include "PacketLayouts.h"
+#include "PacketRules.h"
+#include "SpscQueue.h"
+#include "Steering.h"
+#include "TickArena.h"
+#include "TripleBuffer.h"
+#include "ZoneArena.h"
+
+#include <filesystem>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <format>
+#include <string>
+#include <ctime>
+#include <list>
+#include <map>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <thread>
+
+ /**
+  * Stockpile Class Implementation
+  *
+  * This is the main class object the plugin will create an instance of and return to Ashita when
+  * the 'CreatePlugin' export is called. This class MUST inherit from the 'IPlugin' interface to
+  * work properly with Ashita.
+  */
+class Stockpile final : public IPlugin
+{
+    // ASHITA
+    IAshitaCore* m_AshitaCore;          // The main AshitaCore object pointer.
+    ILogManager* m_LogManager;          // The main LogManager object pointer.
+    IDirect3DDevice8* m_Direct3DDevice; // The main Direct3D device object pointer.
+    uint32_t m_PluginId;                // The plugins id. (It's base address.)
+
+    char window_title[255]{};
+
+    // CONFIG DEFAULTS
+    // Tolerances (Bot)
+    float tolerance_yaw = 0.25f;	    // YAW Tolerance				            0.10 to  0.5 Yalms (Default:  0.20)
+    float tolerance_z = 4.0f;           // Z Tolerance					            0.50 to 20.0 Yalms (Default:  4.00)
+    // Ranges (Bot)
+    float range_new_target = 25.0f;     // Range to choose a new target	           20.00 to 50.0 Yalms (Default: 25.00)
+    float range_engage = 19.0f;	        // Range to engage target		           10.00 to 30.0 Yalms (Default: 17.00)
+    float range_attacking = 2.5f;	    // Range to stop moving			            2.00 to  4.0 Yalms (Default:  2.50)
+    float range_minimum = 1.0f;	        // Range to move backwards		            1.00 to  2.0 Yalms (Default:  1.00)
+    // Ranges (Pathing)
+    float range_next_path = 3.0f;       // Range to process next node on path       5.00 to 20.0 Yalms (Default:  5.00)
+    float range_auto_pathing = 10.0f;   // Range to create a new autopathing node   5.00 to 10.0 Yalms (Default:  5.00)
+
+    // CONFIG STATIC
+    bool debug = true;                  // Sets debug mode. (Default: false)
+    bool custom_style = false;          // Applies the Stockpile ImGui style once at Direct3DInitialize. (Default: false)
+    bool use_packet_actions = true;     // Engage / disengage with injected packets, false to use chat commands. (Default: true)
+
+    // ZONE DATA
+    // Everything that lives for one zone is allocated from zone_arena through the zone context, ZoneReset drops the
+    // context and releases the arena as a whole on zone change.
+    struct ZoneContext
+    {
+        MobTable mob_table;                 // Loaded by LoadMobDatData.
+        NameArena unique_names;             // Sorted mob_table names, only decoded once the Targets panel is opened.
+        NameIndex name_index;               // Search index over unique_names, built with them.
+        std::pmr::vector<int> filtered;     // Indexes into unique_names that match the search and pass the potential bans filter.
+
+        explicit ZoneContext(std::pmr::memory_resource* resource)
+            : mob_table(resource)
+            , unique_names(resource)
+            , name_index(resource)
+            , filtered(resource)
+        {}
+    };
+
+    ZoneArena zone_arena{ 256 * 1024 };
+    std::optional<ZoneContext> zone_context{ std::in_place, &zone_arena };
+
+    std::vector<std::string> mobs_common_bans = {"???", "", "none", "EFFECTER"};
+    std::vector<std::string> mobs_potential_bans = {",", ".", "#", "Moogle"};
+    bool mobs_names_dirty = true;       // Zone changed since unique_names was decoded.
+    std::vector<std::string> mobs_selected;
+    Matcher mobs_matcher;               // mobs_selected and mobs_potential_bans, recompiled by CompileMatcher when either changes.
+
+    struct Pos
+    {
+        float x;
+        float y;
+        float z;
+    };
+
+    std::vector<Pos> auto_pathing_positions;
+    Pos pos_old{};
+
+    int item_current_idx = 0;
+    char mtarget[128]{};
+    char mobs_search[NameIndex::MaxQuery]{};
+    char mobs_search_applied[NameIndex::MaxQuery]{};    // The search the filtered list was built for.
+    float mobs_search_us = 0;                           // Time the last FilterTargets took.
+
+    // GUI LISTS
+    bool mobs_filtered_dirty = true;    // Rebuild the filtered list on the next frame. (Zone, include_pit or selection changed.)
+
+    // GUI STATUS (Only reformatted when the value changes.)
+    Label<bool> label_running{ "Running: %s" };
+    Label<bool> label_has_target{ "Has Target: %s" };
+    Label<bool> label_has_lock{ "Has Lock: %s" };
+    Label<const char*> label_closest_target_name{ "Closest Target Name: %s" };
+    Label<int> label_closest_target_id{ "Closest Target ID: %d" };
+    Label<float> label_closest_target_distance{ "Closest Target Distance: %.2f" };
+    Label<int> label_next_target_id{ "Next Target ID: %d" };
+    Label<const char*> label_targeted_name{ "Target Name: %s" };
+    Label<int> label_targeted_id{ "Target ID: %d" };
+    Label<bool> label_auto_pathing{ "Auto-Pathing Running: %s" };
+    Label<float> label_zone_memory{ "Zone Memory: %.2f KB (Used)" };
+    Label<float> label_zone_resident{ "Zone Memory: %.2f KB (Resident)" };
+
+    // GUI SESSION (The histogram summaries are reformatted once a second, or when Metrics::Version changes.)
+    static constexpr uint64_t SummaryMs = 1000;
+    Label<uint64_t, uint64_t, uint64_t> label_session{ "Running: %02llu:%02llu:%02llu" };
+    Label<uint32_t, float> label_kills{ "Kills: %u (%.1f / hour)" };
+    Label<uint32_t> label_retargets{ "Retargets: %u" };
+    Label<uint32_t, float> label_commands{ "Commands: %u (%.1f / minute)" };
+    Label<uint32_t> label_decisions_dropped{ "Decisions Dropped: %u" };
+    char summary_states[Metrics::States][128]{};
+    char summary_times[3][128]{};
+    char summary_reactions[size_t(Reaction::Count)][128]{};
+    char summary_mobs[Metrics::Names][64]{};
+    uint32_t summary_mob_count = 0;
+    uint32_t summary_version = 0;       // Metrics::Version the summaries were formatted at, 0 formats on the next frame.
+    uint64_t summary_ms = 0;
+
+    // CONTROLS (Bit n of a key mask is the nth control.)
+    enum ControlKey : uint8_t
+    {
+        KeyBackward = 0x01,
+        KeyForward = 0x02,
+        KeyLeft = 0x04,
+        KeyRight = 0x08,
+    };
+
+    std::list<Control> controls
+    {
+        Control("numpad2", false, false),
+        Control("numpad8", false, false),
+        Control("left", false, false),
+        Control("right", false, false),
+    };
+
+    // ACTIONS
+    ActionQueue actions;
+    std::unique_ptr<IActionSink> action_sink;
+
+    // RUNNING
+    bool running = false;
+    bool auto_pathing = false;
+
+    IEntity* entity = nullptr;
+    ITarget* target = nullptr;
+
+    // PLAYER
+    int player_id;
+    uint32_t player_server_id = 0;      // Sampled with the entities, compared against claims.
+
+    // IDS
+    int targeted_id = -1;
+    const char* targeted_name = "No Valid Target";
+
+    // BOOLS
+    bool has_lock = false;
+    bool has_target = false;
+    bool is_player_dead = false;
+
+    // ENTITIES
+    EntityTracker entities;
+    std::array<uint8_t, EntityTracker::Count> mobs_class{};    // Matcher flags per slot, set when the slot spawns.
+    bool mobs_reclassify = true;        // Matcher changed, reclassify every slot on the next frame.
+
+    // PACKET INVALIDATION
+    EntityTracker::Handle invalidated_handle;
+    EntityTracker::Handle invalidated_next_handle;
+    uint32_t invalidated_sequence = 0;  // Snapshot published with the last invalidation.
+
+    // CAPTURE (Render thread, every packet in and out is recorded while open.)
+    PacketCapture capture;
+
+    // CHAT (Render thread, lines are classified as they arrive and applied at the start of the next frame.)
+    static constexpr uint64_t UnreachableMs = 30000;
+    static constexpr uint64_t DefeatConfirmMs = 2000;
+
+    struct Unreachable
+    {
+        EntityTracker::Handle handle;
+        uint64_t until_ms;
+    };
+
+    ChatClassifier chat_classifier;
+    uint32_t chat_events = 0;           // ChatClassifier events since the last frame.
+    std::array<Unreachable, 8> unreachable{};   // Mobs the chat said cannot be seen or attacked, oldest overwritten.
+    uint32_t unreachable_next = 0;
+    uint32_t out_of_range_count = 0;    // Too far / out of range lines about the closest target, since load.
+    EntityTracker::Handle defeat_handle;    // Target a defeat line named, dropped once its HP or status confirms it.
+    uint64_t defeat_until_ms = 0;       // When an unconfirmed defeat line is given up on, 0 for none.
+
+    // WORKER
+    // Targeting and pathing run on the worker thread. Each frame the render thread publishes a Snapshot of
+    // everything a decision reads, and applies the Decisions the worker queued back. Neither side waits on the
+    // other, and the worker never touches game memory or the render thread's members.
+    struct Settings
+    {
+        float tolerance_yaw;
+        float tolerance_z;
+        float range_new_target;
+        float range_engage;
+        float range_attacking;
+        float range_minimum;
+        float range_next_path;
+    };
+
+    struct Snapshot
+    {
+        uint32_t sequence;
+        uint64_t tick_ms;
+        bool running;
+        bool is_player_dead;
+        bool has_target;
+        bool has_lock;
+        int zone_id;
+        int player_id;
+        uint32_t player_server_id;
+        Pos player;
+        float player_heading;
+        int targeted_id;
+        EntityTracker::Handle invalidated;              // Last target a packet invalidated.
+        EntityTracker::Handle invalidated_next;         // Last next target a packet invalidated.
+        uint32_t out_of_range_count;                    // Increases when the chat says the target is out of reach.
+        Settings settings;                              // Slider values as of this frame.
+        std::shared_ptr<const std::vector<Pos>> path;   // Replaced, never modified, when the path changes.
+        uint32_t path_version;
+        std::shared_ptr<const NavGrid> nav;             // Null until the zone's grid is loaded, or if it has none.
+        EntityTracker::Frame entities;                  // Only filled while running.
+        uint32_t entities_version;                      // EntityTracker::Version of entities, copied only when it changes.
+    };
+
+    enum Command : uint8_t
+    {
+        CommandEscapeDown = 0x01,
+        CommandEscapeUp = 0x02,
+    };
+
+    struct Decision
+    {
+        uint32_t sequence;                  // Snapshot this was decided from.
+        uint8_t keys;                       // ControlKey mask held until the next decision.
+        uint8_t commands;                   // Command mask, sent once.
+        int select_id;                      // Target to select, -1 for none.
+        int engage_id;                      // Target to engage, -1 for none.
+        int closest_target_id;
+        float closest_target_distance;
+        int next_target_id;                 // Picked while fighting, taken the tick the closest target dies. -1 for none.
+        BotState state;                     // State whose tick made this decision.
+        uint16_t decide_us;                 // How long deciding took.
+        uint64_t snapshot_ms;               // tick_ms of the snapshot it was decided from.
+    };
+
+    // The closest target as one decision sees it, filled by TrackTarget.
+    struct Engagement
+    {
+        const EntityTracker::Entry* entry;
+        float distance;
+        float heading_difference;
+    };
+
+    TripleBuffer<Snapshot> snapshots;
+    SpscQueue<Decision, 16> decisions;
+    std::thread worker;
+    std::atomic<bool> worker_stop{ false };
+    uint32_t snapshot_sequence = 0;
+    std::atomic<uint32_t> decisions_dropped{ 0 };   // Decisions lost to a full queue, counted by the worker.
+
+    // PUBLISHED PATH (Render thread.)
+    std::shared_ptr<const std::vector<Pos>> path_published;
+    uint32_t path_version = 0;
+    bool path_dirty = true;             // auto_pathing_positions changed since path_published.
+
+    // NAVIGATION (Render thread, the grid loads on nav_thread.)
+    std::thread nav_thread;
+    std::atomic<bool> nav_cancel{ false };
+    std::atomic<bool> nav_ready{ false };
+    std::shared_ptr<const NavGrid> nav_built;       // Written by nav_thread, taken once nav_ready is set.
+    std::shared_ptr<const NavGrid> nav_published;
+
+    // DECIDED (Render thread, the last decision applied.)
+    Decision decided{ 0, 0, 0, -1, -1, -1, 0, -1 };
+    const char* closest_target_name = "No Valid Target";
+
+    // STATE (Worker thread.)
+    BotState bot_state = BotState::Idle;
+
+    // CLOSEST TARGET (Worker thread.)
+    int closest_target_id = -1;
+    EntityTracker::Handle closest_target_handle;
+    int worker_zone_id = -1;
+    AggroQueue aggro;                   // Mobs attacking the player, closest first, synced from the snapshot.
+
+    // NEXT TARGET (Worker thread, kept current while fighting the closest target.)
+    int next_target_id = -1;
+    EntityTracker::Handle next_target_handle;
+    uint64_t next_target_ms = 0;        // When it was picked, it settles while the fight goes on.
+
+    // CLOSEST PATH ID (Worker thread.)
+    int closest_path_id = -1;
+    bool reverse_path = false;
+    uint32_t worker_path_version = 0;
+
+    // NAVIGATION (Worker thread.)
+    NavGrid::Query nav_query;
+    std::vector<NavGrid::Point> nav_waypoints;
+    size_t nav_waypoint = 0;
+    std::shared_ptr<const NavGrid> nav_planned;     // Grid the waypoints were planned on.
+    Pos nav_goal{};
+    uint64_t nav_planned_ms = 0;
+
+    // TIMERS (Worker thread, advanced once per snapshot with its tick_ms.)
+    enum TimerEvent : uint32_t
+    {
+        TimerAttackReady,               // Attack retry cooldown.   (3s)
+        TimerSelectReady,               // Select retry cooldown.   (3s)
+        TimerTargetSettled,             // New target settle time.  (5s)
+        TimerEscapeRelease,             // Jittered escape key release.
+        TimerCloseIn,                   // Out of range close in.   (1s)
+    };
+
+    TimerWheel<> timers;
+    TimerWheel<>::Handle timer_target_settled;
+
+    bool attack_ready = true;
+    bool select_ready = true;
+    bool target_settled = false;
+    bool escape_down = false;
+    bool close_in = false;              // The chat said the target is out of reach, hold forward.
+    uint32_t worker_out_of_range_count = 0;
+
+    // MOVING (Worker thread.)
+    bool target_moving = true;
+    Steering steering;
+
+    // ZONE
+    int zone_id = -1;
+
+    // CLAIMS (Shared with other Stockpile instances on this host.)
+    ClaimTable claims;
+    uint64_t tick_ms = 0;               // Steady clock milliseconds, sampled once per frame.
+
+    // TRANSIENT STRINGS (Reset at the start of every frame.)
+    TickArena tick_arena{ 16 * 1024 };
+
+#if defined(_DEBUG)
+    // ALLOCATION ACCOUNTING
+    uint32_t steady_frames = 0;
+    std::array<uint32_t, size_t(Subsystem::Count)> allocations_seen{};
+    std::array<bool, size_t(Subsystem::Count)> allocations_reported{};
+#endif
+
+    // METRICS (Render thread.)
+    Metrics metrics;
+    int metrics_target_id = -1;         // Closest target as of the last frame.
+    bool metrics_engaged = false;       // Locked on to metrics_target_id at least once.
+    char metrics_target_name[0x1C]{};
+
+    // COLORS
+    ImVec4 red      = ImVec4(0.83f, 0.33f, 0.28f, 1.00f);
+    ImVec4 green    = ImVec4(0.33f, 0.83f, 0.28f, 1.00f);
+
+    // BANS
+    bool include_pit = false;
+
+public:
+    Stockpile(void);
+    ~Stockpile(void);
+
+    // Plugin Information Properties
+    const char* GetName(void) const override;
+    const char* GetAuthor(void) const override;
+    const char* GetDescription(void) const override;
+    const char* GetLink(void) const override;
+    double GetVersion(void) const override;
+    double GetInterfaceVersion(void) const override;
+    int32_t GetPriority(void) const override;
+    uint32_t GetFlags(void) const override;
+
+    // General Methods
+    bool Initialize(IAshitaCore* core, ILogManager* logger, uint32_t id) override;
+    void Release(void) override;
+
+    // Event Callbacks: ChatManager
+    bool HandleCommand(int32_t mode, const char* command, bool injected) override;
+    bool HandleIncomingText(int32_t mode, bool indent, const char* message, int32_t* modifiedMode, bool* modifiedIndent, char* modifiedMessage, bool injected, bool blocked) override;
+
+    // Event Callbacks: PacketManager
+    bool HandleIncomingPacket(uint16_t id, uint32_t size, const uint8_t* data, uint8_t* modified, uint32_t sizeChunk, const uint8_t* dataChunk, bool injected, bool blocked) override;
+    bool HandleOutgoingPacket(uint16_t id, uint32_t size, const uint8_t* data, uint8_t* modified, uint32_t sizeChunk, const uint8_t* dataChunk, bool injected, bool blocked) override;
+
+    // Event Callbacks: Direct3D
+    bool Direct3DInitialize(IDirect3DDevice8* device) override;
+    void Direct3DBeginScene(bool isRenderingBackBuffer) override;
+    void Direct3DEndScene(bool isRenderingBackBuffer) override;
+    void Direct3DPresent(const RECT* pSourceRect, const RECT* pDestRect, HWND hDestWindowOverride, const RGNDATA* pDirtyRegion) override;
+
+    // Helpers.cpp
+    void Log(const std::string& str);
+    void Log(const char* str);
+    void QueueCommand(int32_t, const char* str);
+    int RandomFV(int factor, int var);
+    int RandomA(int factor);
+    int Random(int min, int max);
+    void ltrim(std::string& s);
+    void rtrim(std::string & s);
+    void trim(std::string & s);
+    bool contains_find(const std::vector<std::string>& vec, std::string_view search);
+    float distance(Pos p1, Pos p2);
+    uint64_t Milliseconds();
+    uint64_t Microseconds();
+    void ListClipBegin(int count, int& first, int& last);
+    void ListClipEnd(int count, int last);
+
+    // Control.cpp
+    void ControlsReload();
+    void ControlsReset();
+    void ControlsDown(uint8_t keys);
+    void Controls();
+
+    bool Decide(const Snapshot& s, Decision& decision);
+    void Retarget(const Snapshot& s);
+    bool AcquireTarget(const Snapshot& s);
+    bool AcquireAggro(const Snapshot& s);
+    bool AcquireNext(const Snapshot& s);
+    void PlanNext(const Snapshot& s);
+    bool IsViable(const Snapshot& s, int index);
+    void PickTarget(const Snapshot& s, int index);
+    void OnTimer(uint32_t event, Decision& decision);
+    float GetHeadingDifference(const Snapshot& s, float x2, float y2);
+    void ResetDecisions();
+
+    // States.cpp
+    using StateTick = BotState (Stockpile::*)(const Snapshot& s, Decision& decision);
+    static const StateTick state_ticks[size_t(BotState::Count)];
+
+    void Enter(BotState state);
+    BotState TickIdle(const Snapshot& s, Decision& decision);
+    BotState TickPatrol(const Snapshot& s, Decision& decision);
+    BotState TickAcquire(const Snapshot& s, Decision& decision);
+    BotState TickApproach(const Snapshot& s, Decision& decision);
+    BotState TickEngage(const Snapshot& s, Decision& decision);
+    BotState TickFight(const Snapshot& s, Decision& decision);
+    BotState TickRecover(const Snapshot& s, Decision& decision);
+    bool TrackTarget(const Snapshot& s, Decision& decision, Engagement& t);
+
+    // Worker.cpp
+    void WorkerStart();
+    void WorkerStop();
+    void WorkerMain();
+    void PublishSnapshot();
+    void ApplyDecisions();
+
+    // Navigation.cpp
+    void NavLoad(int zone);
+    void NavPoll();
+    void NavStop();
+    Pos Navigate(const Snapshot& s, const Pos& goal);
+    Pos PursuitPoint(const Snapshot& s, const std::vector<Pos>& path);
+
+    // Actions.cpp
+    void ActionsInitialize();
+    void QueueAction(Action action, int index);
+    void FlushActions();
+
+    // Allocations.cpp
+    void CheckAllocations();
+
+    // Metrics.cpp
+    void UpdateMetrics();
+    void TraceReactions();
+    void ExportMetrics();
+    void FormatSummary();
+
+    // Entities.cpp
+    void UpdateEntities();
+    void UpdateCandidate(uint32_t index);
+    uint8_t ClassifyMob(uint32_t index);
+
+    // Chat.cpp
+    void OnChatLine(int32_t mode, const char* message);
+    void ApplyChatEvents();
+    bool IsUnreachable(uint32_t index) const;
+
+    // Packets.cpp
+    bool DispatchIncomingPacket(uint16_t id, uint32_t size, const uint8_t* data);
+    bool DispatchOutgoingPacket(uint16_t id, uint32_t size, const uint8_t* data);
+    int ClosestTarget() const;
+    int NextTarget() const;
+    uint32_t PlayerServerId() const;
+    EntityTracker& Entities();
+    void ObserveEngage(uint16_t index);
+    void InvalidateTarget(int index, const char* source, const char* reason);
+    void InvalidateNext(int index, const char* reason);
+    void PublishInvalidation(int index);
+    void CaptureStart();
+    void CaptureStop();
+
+    // DATS
+    void ZoneReset();
+    void LoadMobDatData();
+
+    // TARGETS
+    void CompileMatcher();
+
+    // GUI
+    void ApplyStyle();
+    void DecodeNames();
+    void FilterTargets();
+    void AddMatches();
+};
+
 #endif // __ASHITA_STOCKPILE_H_INCLUDED__
\ No newline at end of file
@@ -0,0 +1,113 @@
+#ifndef TICK_ARENA_H_INCLUDED
+#define TICK_ARENA_H_INCLUDED
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <memory>
+#include <string_view>
+
+/**
+ * TickArena Class Implementation
+ *
+ * Monotonic arena for transient strings and buffers on the render thread. The buffer is allocated once, Reset at the
+ * start of every frame and handed out by bumping an offset, so formatting commands no longer touches the heap.
+ *
+ * Format never fails: output that does not fit in what is left of the arena is truncated. (An empty string once
+ * the arena is exhausted.) Exhaustions are counted so an undersized arena shows up instead of silently dropping.
+ */
+class TickArena final
+{
+    std::unique_ptr<char[]> buffer;
+    size_t capacity;
+    size_t offset;
+    size_t peak;
+    uint32_t exhausted;
+
+public:
+    explicit TickArena(size_t _capacity)
+        : buffer(new char[_capacity])
+        , capacity(_capacity)
+        , offset(0)
+        , peak(0)
+        , exhausted(0)
+    {}
+    ~TickArena(void) {}
+
+    TickArena(const TickArena&) = delete;
+    TickArena& operator=(const TickArena&) = delete;
+
+    void Reset()
+    {
+        peak = offset > peak ? offset : peak;
+        offset = 0;
+    }
+
+    /**
+     * Allocates size bytes aligned to align, nullptr if the arena is exhausted.
+     */
+    void* Allocate(size_t size, size_t align = alignof(std::max_align_t))
+    {
+        const size_t start = (offset + align - 1) & ~(align - 1);
+
+        if (start + size > capacity)
+        {
+            exhausted++;
+            return nullptr;
+        }
+
+        offset = start + size;
+
+        return buffer.get() + start;
+    }
+
+    /**
+     * Formats into the arena and returns a NUL terminated string valid until the next Reset.
+     */
+    template <typename... Args>
+    const char* Format(std::format_string<Args...> format, Args&&... args)
+    {
+        char* out = buffer.get() + offset;
+        const size_t available = capacity - offset;
+
+        if (available == 0)
+        {
+            exhausted++;
+            return "";
+        }
+
+        const auto result = std::format_to_n(out, available - 1, format, std::forward<Args>(args)...);
+        const size_t written = size_t(result.out - out);
+
+        if (size_t(result.size) > written)
+        {
+            exhausted++;
+        }
+
+        out[written] = '\0';
+        offset += written + 1;
+
+        return out;
+    }
+
+    size_t Used() const
+    {
+        return offset;
+    }
+
+    size_t Peak() const
+    {
+        return peak > offset ? peak : offset;
+    }
+
+    uint32_t Exhausted() const
+    {
+        return exhausted;
+    }
+};
+
+#endif // TICK_ARENA_H_INCLUDED
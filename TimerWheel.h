@@ -0,0 +1,254 @@
+#ifndef TIMER_WHEEL_H_INCLUDED
+#define TIMER_WHEEL_H_INCLUDED
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <array>
+#include <cstdint>
+
+/**
+ * TimerWheel Class Implementation
+ *
+ * Hierarchical timer wheel driven by a single timestamp per tick. Scheduling, cancelling and firing a timer are all
+ * O(1), so adding more timed behaviours does not add per frame polling.
+ *
+ * Three levels of 64 slots with a 10 millisecond resolution cover 640 ms, 41 seconds and 43 minutes. Timers live in
+ * a fixed pool of Capacity nodes linked into their slot, so the wheel never allocates. Timers further out than
+ * the last level are clamped to it and simply cascade again when they come around.
+ *
+ * Start must be called with the current time before scheduling anything, Advance is then called once per tick.
+ * A Handle carries the node generation, cancelling a timer that already fired (or whose node was reused) is a no-op.
+ */
+template <uint32_t Capacity = 64>
+class TimerWheel final
+{
+public:
+    static constexpr uint64_t Resolution = 10;  // Milliseconds per tick.
+
+    struct Handle
+    {
+        uint32_t node = 0;
+        uint32_t generation = 0;
+    };
+
+private:
+    static constexpr uint32_t Bits = 6;
+    static constexpr uint32_t Slots = 1 << Bits;
+    static constexpr uint32_t Levels = 3;
+    static constexpr uint32_t None = 0xFFFFFFFF;
+
+    struct Node
+    {
+        uint64_t expires;               // Tick.
+        uint32_t event;
+        uint32_t generation;
+        uint32_t prev;
+        uint32_t next;
+        uint32_t slot;                  // Level * Slots + slot, None while free.
+    };
+
+    std::array<Node, Capacity> nodes{};
+    std::array<uint32_t, Levels * Slots> heads{};
+    uint32_t free;
+    uint32_t count;
+    uint64_t tick;
+
+public:
+    TimerWheel(void)
+        : free(0)
+        , count(0)
+        , tick(0)
+    {
+        heads.fill(None);
+
+        for (uint32_t n = 0; n < Capacity; n++)
+        {
+            nodes[n].next = n + 1 < Capacity ? n + 1 : None;
+            nodes[n].slot = None;
+        }
+    }
+    ~TimerWheel(void) {}
+
+    /**
+     * Sets the wheel's current time. Must be called once before anything is scheduled.
+     */
+    void Start(uint64_t now)
+    {
+        tick = now / Resolution;
+    }
+
+    /**
+     * Schedules an event to fire after delay milliseconds.
+     *
+     * @return {Handle} The timer handle, node is None if the pool is exhausted.
+     */
+    Handle Schedule(uint32_t event, uint64_t delay)
+    {
+        if (free == None)
+        {
+            return Handle{ None, 0 };
+        }
+
+        const uint32_t n = free;
+        free = nodes[n].next;
+
+        nodes[n].expires = tick + (delay + Resolution - 1) / Resolution;
+        nodes[n].event = event;
+        nodes[n].generation++;
+
+        Link(n);
+        count++;
+
+        return Handle{ n, nodes[n].generation };
+    }
+
+    /**
+     * Cancels a pending timer.
+     *
+     * @return {bool} True if the timer was pending, false if it already fired or was cancelled.
+     */
+    bool Cancel(const Handle& handle)
+    {
+        if (handle.node >= Capacity || nodes[handle.node].generation != handle.generation || nodes[handle.node].slot == None)
+        {
+            return false;
+        }
+
+        Unlink(handle.node);
+        Release(handle.node);
+
+        return true;
+    }
+
+    bool IsPending(const Handle& handle) const
+    {
+        return handle.node < Capacity && nodes[handle.node].generation == handle.generation && nodes[handle.node].slot != None;
+    }
+
+    /**
+     * Advances the wheel to now, invoking fire(event) for every timer that expired.
+     */
+    template <typename F>
+    void Advance(uint64_t now, F&& fire)
+    {
+        const uint64_t target = now / Resolution;
+
+        // NOTHING PENDING, JUMP STRAIGHT THERE
+        if (count == 0)
+        {
+            tick = target > tick ? target : tick;
+            return;
+        }
+
+        while (tick < target)
+        {
+            tick++;
+
+            // CASCADE HIGHER LEVELS DOWN WHEN A LOWER LEVEL WRAPS
+            for (uint32_t level = 1; level < Levels && (tick & ((uint64_t(1) << (Bits * level)) - 1)) == 0; level++)
+            {
+                Cascade(level, uint32_t(tick >> (Bits * level)) & (Slots - 1));
+            }
+
+            uint32_t& head = heads[tick & (Slots - 1)];
+
+            while (head != None)
+            {
+                const uint32_t n = head;
+                const uint32_t event = nodes[n].event;
+
+                Unlink(n);
+                Release(n);
+
+                fire(event);
+            }
+
+            if (count == 0)
+            {
+                tick = target;
+            }
+        }
+    }
+
+    uint32_t Pending() const
+    {
+        return count;
+    }
+
+private:
+    void Link(uint32_t n)
+    {
+        const uint64_t delta = nodes[n].expires > tick ? nodes[n].expires - tick : 0;
+
+        uint32_t level = 0;
+        while (level + 1 < Levels && delta >= (uint64_t(1) << (Bits * (level + 1))))
+        {
+            level++;
+        }
+
+        // DUE NOW, FIRE ON THE NEXT TICK. BEYOND THE LAST LEVEL, CLAMP TO IT.
+        uint64_t expires = nodes[n].expires > tick ? nodes[n].expires : tick + 1;
+        if (level == Levels - 1 && delta >= (uint64_t(1) << (Bits * Levels)))
+        {
+            expires = tick + (uint64_t(1) << (Bits * Levels)) - 1;
+        }
+
+        const uint32_t slot = level * Slots + (uint32_t(expires >> (Bits * level)) & (Slots - 1));
+
+        nodes[n].slot = slot;
+        nodes[n].prev = None;
+        nodes[n].next = heads[slot];
+
+        if (heads[slot] != None)
+        {
+            nodes[heads[slot]].prev = n;
+        }
+
+        heads[slot] = n;
+    }
+
+    void Unlink(uint32_t n)
+    {
+        Node& node = nodes[n];
+
+        if (node.prev != None)
+        {
+            nodes[node.prev].next = node.next;
+        }
+        else
+        {
+            heads[node.slot] = node.next;
+        }
+
+        if (node.next != None)
+        {
+            nodes[node.next].prev = node.prev;
+        }
+
+        node.slot = None;
+    }
+
+    void Release(uint32_t n)
+    {
+        nodes[n].next = free;
+        free = n;
+        count--;
+    }
+
+    void Cascade(uint32_t level, uint32_t slot)
+    {
+        uint32_t n = heads[level * Slots + slot];
+        heads[level * Slots + slot] = None;
+
+        while (n != None)
+        {
+            const uint32_t next = nodes[n].next;
+            Link(n);
+            n = next;
+        }
+    }
+};
+
+#endif // TIMER_WHEEL_H_INCLUDED
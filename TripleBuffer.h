@@ -0,0 +1,103 @@
+#ifndef TRIPLE_BUFFER_H_INCLUDED
+#define TRIPLE_BUFFER_H_INCLUDED
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+/**
+ * TripleBuffer Class Implementation
+ *
+ * Single producer, single consumer handoff of a large value without locks and without either side ever waiting
+ * on the other. The producer fills Back and Publishes it, the consumer Acquires the most recently published value
+ * and reads it through Front. Values published while the consumer was busy are skipped, never queued.
+ *
+ * The three buffers rotate through a single atomic index: the producer swaps its back buffer into the middle, the
+ * consumer swaps its front buffer out of it. The Fresh bit marks a middle buffer that has not been acquired yet.
+ *
+ * Wait blocks the consumer until something new is published. (Or Wake is called, ie. to stop it.)
+ */
+template <typename T>
+class TripleBuffer final
+{
+    static constexpr uint32_t Index = 0x03;
+    static constexpr uint32_t Fresh = 0x04;
+
+    std::array<T, 3> buffers{};
+    std::atomic<uint32_t> middle;
+    std::atomic<uint32_t> published;
+    uint32_t back;                      // Producer only.
+    uint32_t front;                     // Consumer only.
+
+public:
+    TripleBuffer(void)
+        : middle(1)
+        , published(0)
+        , back(0)
+        , front(2)
+    {}
+    ~TripleBuffer(void) {}
+
+    TripleBuffer(const TripleBuffer&) = delete;
+    TripleBuffer& operator=(const TripleBuffer&) = delete;
+
+    /**
+     * The buffer being written by the producer. Holds whatever was published two swaps ago, so fill every field.
+     */
+    T& Back()
+    {
+        return buffers[back];
+    }
+
+    void Publish()
+    {
+        back = middle.exchange(back | Fresh, std::memory_order_acq_rel) & Index;
+        Wake();
+    }
+
+    /**
+     * Takes the most recently published buffer as Front.
+     *
+     * @return {bool} True if a new buffer was published since the last Acquire, false if Front is unchanged.
+     */
+    bool Acquire()
+    {
+        if ((middle.load(std::memory_order_relaxed) & Fresh) == 0)
+        {
+            return false;
+        }
+
+        front = middle.exchange(front, std::memory_order_acq_rel) & Index;
+
+        return true;
+    }
+
+    const T& Front() const
+    {
+        return buffers[front];
+    }
+
+    /**
+     * Blocks until the publish count differs from seen.
+     *
+     * @return {uint32_t} The current publish count, pass it to the next Wait.
+     */
+    uint32_t Wait(uint32_t seen)
+    {
+        published.wait(seen, std::memory_order_acquire);
+
+        return published.load(std::memory_order_acquire);
+    }
+
+    void Wake()
+    {
+        published.fetch_add(1, std::memory_order_release);
+        published.notify_one();
+    }
+};
+
+#endif // TRIPLE_BUFFER_H_INCLUDED
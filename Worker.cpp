@@ -0,0 +1,161 @@
+#ifndef WORKER_H_INCLUDED
+#define WORKER_H_INCLUDED
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include "Stockpile.h"
+#include "Zones.h"
+
+void Stockpile::WorkerStart()
+{
+    worker_stop.store(false, std::memory_order_release);
+    worker = std::thread([this] { WorkerMain(); });
+}
+
+void Stockpile::WorkerStop()
+{
+    if (!worker.joinable())
+    {
+        return;
+    }
+
+    worker_stop.store(true, std::memory_order_release);
+    snapshots.Wake();
+    worker.join();
+}
+
+/**
+ * Decides once per published snapshot. Snapshots published while a decision is running are skipped, the worker
+ * always decides on the latest frame.
+ */
+void Stockpile::WorkerMain()
+{
+    uint32_t seen = 0;
+
+    while (!worker_stop.load(std::memory_order_acquire))
+    {
+        seen = snapshots.Wait(seen);
+
+        if (!snapshots.Acquire())
+        {
+            continue;
+        }
+
+        AllocationScope scope(Subsystem::Targeting);
+
+        Decision decision{ 0, 0, 0, -1, -1, -1, 0, -1 };
+
+        const auto start = std::chrono::steady_clock::now();
+        const bool queue = Decide(snapshots.Front(), decision);
+        const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+        decision.decide_us = uint16_t(std::min<int64_t>(elapsed, UINT16_MAX));
+
+        if (queue && !decisions.Push(decision))
+        {
+            decisions_dropped.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+}
+
+/**
+ * Copies everything the next decision reads into the back snapshot and publishes it. (Render thread.)
+ */
+void Stockpile::PublishSnapshot()
+{
+    Snapshot& s = snapshots.Back();
+
+    s.sequence = ++snapshot_sequence;
+    s.tick_ms = tick_ms;
+    s.running = running;
+    s.is_player_dead = is_player_dead;
+    s.has_target = has_target;
+    s.has_lock = has_lock;
+    s.zone_id = zone_id;
+    s.player_id = player_id;
+    s.player_server_id = entity->GetServerId(player_id);
+    s.player = { entity->GetLocalPositionX(player_id), entity->GetLocalPositionY(player_id), entity->GetLocalPositionZ(player_id) };
+    s.player_heading = entity->GetHeading(player_id);
+    s.targeted_id = targeted_id;
+    s.invalidated = invalidated_handle;
+    s.invalidated_next = invalidated_next_handle;
+    s.out_of_range_count = out_of_range_count;
+    s.settings = { tolerance_yaw, tolerance_z, range_new_target, range_engage, range_attacking, range_minimum, range_next_path };
+
+    // THE WORKER KEEPS READING THE OLD PATH UNTIL IT TAKES THIS SNAPSHOT
+    if (path_dirty)
+    {
+        path_published = std::make_shared<const std::vector<Pos>>(auto_pathing_positions);
+        path_version++;
+        path_dirty = false;
+    }
+
+    s.path = path_published;
+    s.path_version = path_version;
+    s.nav = nav_published;
+
+    // THE BACK BUFFER HOLDS THE FRAME OF TWO PUBLISHES AGO, ONLY COPIED WHEN THE TRACKER CHANGED SINCE
+    if (running && s.entities_version != entities.Version())
+    {
+        s.entities = entities.Current();
+        s.entities_version = entities.Version();
+    }
+
+    snapshots.Publish();
+}
+
+/**
+ * Applies every decision the worker queued since the last frame, oldest first. (Render thread.)
+ *
+ * Held keys come from the newest decision, one shot selects, engages and commands from all of them. Decisions
+ * made before the bot stopped or the player died are dropped, except for releasing keys.
+ */
+void Stockpile::ApplyDecisions()
+{
+    decisions.Drain([this](const Decision& decision)
+    {
+        if (decision.commands & CommandEscapeDown)
+        {
+            QueueCommand(-1, "/sendkey escape down");
+        }
+
+        if (decision.commands & CommandEscapeUp)
+        {
+            QueueCommand(-1, "/sendkey escape up");
+        }
+
+        if (!running || is_player_dead)
+        {
+            return;
+        }
+
+        ControlsReset();
+        ControlsDown(decision.keys);
+
+        if (decision.select_id != -1)
+        {
+            target->SetTarget(decision.select_id, false);
+            metrics.Reactions().Emit(Reaction::Select, tick_ms, decision.select_id);
+        }
+
+        if (decision.engage_id != -1)
+        {
+            QueueAction(Action::Engage, decision.engage_id);
+        }
+
+        metrics.Decided(decision.state, decision.decide_us);
+        metrics.Reactions().Add(Reaction::Decide, tick_ms > decision.snapshot_ms ? tick_ms - decision.snapshot_ms : 0);
+        metrics.Reactions().Observe(Reaction::Retarget, tick_ms, [&](const ReactionTracer::Pending&) { return decision.sequence >= invalidated_sequence; });
+
+        if (decision.closest_target_id != decided.closest_target_id)
+        {
+            closest_target_name = decision.closest_target_id != -1 ? entity->GetName(decision.closest_target_id) : "No Valid Target";
+        }
+
+        decided = decision;
+    });
+}
+
+#endif // WORKER_H_INCLUDED
@@ -0,0 +1,95 @@
+#ifndef ZONE_ARENA_H_INCLUDED
+#define ZONE_ARENA_H_INCLUDED
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+#pragma once
+#endif
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+
+/**
+ * ZoneArena Class Implementation
+ *
+ * Memory resource for everything that lives exactly as long as one zone. The block is allocated once and handed out
+ * by bumping an offset, deallocation is a no-op, and Release drops the whole zone at once on zone change.
+ *
+ * A zone that needs more than the block spills into the heap through the same monotonic resource, and the spill is
+ * freed by the same Release. The footprint is the block plus the current zone's spill, never the sum of every zone
+ * visited. Containers allocated from the arena must be destroyed before Release.
+ */
+class ZoneArena final : public std::pmr::memory_resource
+{
+    std::unique_ptr<std::byte[]> block;
+    size_t capacity;
+    std::pmr::monotonic_buffer_resource pool;
+    size_t used;
+    size_t peak;
+
+public:
+    explicit ZoneArena(size_t _capacity)
+        : block(new std::byte[_capacity])
+        , capacity(_capacity)
+        , pool(block.get(), _capacity, std::pmr::new_delete_resource())
+        , used(0)
+        , peak(0)
+    {}
+    ~ZoneArena(void) {}
+
+    ZoneArena(const ZoneArena&) = delete;
+    ZoneArena& operator=(const ZoneArena&) = delete;
+
+    void Release()
+    {
+        pool.release();
+        used = 0;
+    }
+
+    /**
+     * @return {size_t} Bytes handed out since the last Release.
+     */
+    size_t Used() const
+    {
+        return used;
+    }
+
+    size_t Peak() const
+    {
+        return peak;
+    }
+
+    size_t Capacity() const
+    {
+        return capacity;
+    }
+
+    /**
+     * @return {size_t} Bytes held right now, the block and anything the current zone spilled past it.
+     */
+    size_t Resident() const
+    {
+        return std::max(capacity, used);
+    }
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override
+    {
+        used += bytes;
+        peak = std::max(peak, used);
+
+        return pool.allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void*, size_t, size_t) override
+    {
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+    {
+        return this == &other;
+    }
+};
+
+#endif // ZONE_ARENA_H_INCLUDED
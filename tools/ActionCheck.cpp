@@ -0,0 +1,162 @@
+/**
+ * Stockpile Action Queue Check
+ *
+ * Runs the action queue (see Actions.h) against a RecordingActionSink, without a game client, and checks:
+ *
+ *  - Build: the outgoing 0x01A packet carries the header, target and category the server expects.
+ *  - Rate limit: an action inside its interval stays queued and goes out on the first Flush after it.
+ *  - Dedupe and capacity: a repeat of a queued action, or a push into a full queue, is dropped.
+ *  - Fallback: with no sink, or a sink that rejects the packet, the action goes to the fallback instead.
+ *
+ * Usage:
+ *
+ *      actioncheck
+ *
+ * Exits with 1 if a check failed.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#include "../Actions.h"
+
+static int failed = 0;
+
+static void Check(bool condition, const char* what)
+{
+    if (!condition)
+    {
+        std::fprintf(stderr, "Failed: %s\n", what);
+        failed = 1;
+    }
+}
+
+/**
+ * Flushes the queue and records the entries handed to the fallback.
+ */
+static uint32_t Flush(ActionQueue& queue, IActionSink* sink, uint64_t now, std::vector<ActionQueue::Entry>& fallbacks)
+{
+    return queue.Flush(sink, now, [&fallbacks](const ActionQueue::Entry& entry)
+    {
+        fallbacks.push_back(entry);
+    });
+}
+
+static void CheckBuild()
+{
+    uint8_t buffer[ActionRequest::Size];
+
+    const uint32_t size = ActionQueue::Build(ActionQueue::Entry{ Action::Engage, 0x0102A3B4, 0x3A5 }, buffer);
+
+    PacketView<ActionRequest> view;
+
+    Check(size == ActionRequest::Size, "build: size");
+    Check(PacketView<ActionRequest>::From(buffer, size, view), "build: view");
+    Check(PacketHeader::Id::Read(buffer) == ActionRequest::Id, "build: header id");
+    Check(PacketHeader::Words::Read(buffer) * 4u == ActionRequest::Size, "build: header size");
+    Check(view.Get<ActionRequest::TargetId>() == 0x0102A3B4, "build: target id");
+    Check(view.Get<ActionRequest::TargetIndex>() == 0x3A5, "build: target index");
+    Check(view.Get<ActionRequest::Category>() == 0x02, "build: engage category");
+    Check(view.Get<ActionRequest::Param>() == 0, "build: param");
+    Check(IActionSink::Sendable(ActionRequest::Id, size, buffer), "build: sendable");
+
+    ActionQueue::Build(ActionQueue::Entry{ Action::Disengage, 0x0102A3B4, 0x3A5 }, buffer);
+
+    Check(view.Get<ActionRequest::Category>() == 0x04, "build: disengage category");
+
+    // WHAT THE PACKET MANAGER WOULD DROP
+    Check(!IActionSink::Sendable(ActionRequest::Id, size, nullptr), "sendable: no data");
+    Check(!IActionSink::Sendable(0x200, size, buffer), "sendable: id over 9 bits");
+    Check(!IActionSink::Sendable(ActionRequest::Id, size - 2, buffer), "sendable: partial word");
+    Check(!IActionSink::Sendable(ActionRequest::Id, size + 4, buffer), "sendable: size disagrees with the header");
+    Check(!IActionSink::Sendable(0x015, size, buffer), "sendable: id disagrees with the header");
+    Check(!IActionSink::Sendable(ActionRequest::Id, 0x200, buffer), "sendable: over 0x1FC bytes");
+}
+
+static void CheckRateLimit()
+{
+    ActionQueue queue;
+    RecordingActionSink sink;
+    std::vector<ActionQueue::Entry> fallbacks;
+
+    Check(queue.Push(Action::Engage, 0x01000010, 0x10), "rate: push");
+    Check(Flush(queue, &sink, 5000, fallbacks) == 1, "rate: first engage sent");
+    Check(sink.packets.size() == 1 && sink.packets[0].id == ActionRequest::Id, "rate: first engage injected");
+
+    // INSIDE THE DEFAULT 1000 MS INTERVAL, THE ENGAGE WAITS. DISENGAGE HAS ITS OWN INTERVAL
+    Check(queue.Push(Action::Engage, 0x01000011, 0x11), "rate: second push");
+    Check(queue.Push(Action::Disengage, 0x01000011, 0x11), "rate: disengage push");
+    Check(Flush(queue, &sink, 5999, fallbacks) == 1, "rate: only the disengage sent");
+    Check(queue.Pending() == 1, "rate: engage still queued");
+    Check(Flush(queue, &sink, 6000, fallbacks) == 1, "rate: engage sent once the interval passed");
+    Check(queue.Pending() == 0 && sink.packets.size() == 3, "rate: queue drained");
+
+    // A SHORTER INTERVAL LETS IT THROUGH SOONER
+    queue.SetInterval(Action::Engage, 100);
+
+    Check(queue.Push(Action::Engage, 0x01000012, 0x12), "interval: push");
+    Check(Flush(queue, &sink, 6099, fallbacks) == 0, "interval: still limited");
+    Check(Flush(queue, &sink, 6100, fallbacks) == 1, "interval: sent after 100 ms");
+    Check(fallbacks.empty(), "rate: nothing fell back");
+}
+
+static void CheckDedupeAndCapacity()
+{
+    ActionQueue queue;
+
+    Check(queue.Push(Action::Engage, 0x01000010, 0x10), "dedupe: push");
+    Check(!queue.Push(Action::Engage, 0x01000010, 0x10), "dedupe: repeat dropped");
+    Check(queue.Push(Action::Disengage, 0x01000010, 0x10), "dedupe: other action kept");
+
+    queue.Clear();
+
+    for (uint16_t n = 0; n < ActionQueue::Capacity; n++)
+    {
+        Check(queue.Push(Action::Engage, 0x01000000 + n, n), "capacity: push");
+    }
+
+    Check(!queue.Push(Action::Engage, 0x01000100, 0x100), "capacity: full queue drops");
+    Check(queue.Pending() == ActionQueue::Capacity, "capacity: pending");
+}
+
+static void CheckFallback()
+{
+    ActionQueue queue;
+    RecordingActionSink sink;
+    std::vector<ActionQueue::Entry> fallbacks;
+
+    // PACKET ACTIONS OFF
+    queue.Push(Action::Engage, 0x01000010, 0x10);
+
+    Check(Flush(queue, nullptr, 5000, fallbacks) == 1, "fallback: sent without a sink");
+    Check(fallbacks.size() == 1 && fallbacks[0].action == Action::Engage && fallbacks[0].index == 0x10, "fallback: no sink");
+
+    // THE SINK REJECTS THE PACKET
+    sink.reject = true;
+    queue.Push(Action::Disengage, 0x01000010, 0x10);
+
+    Check(Flush(queue, &sink, 5000, fallbacks) == 1, "fallback: sent when rejected");
+    Check(fallbacks.size() == 2 && fallbacks[1].action == Action::Disengage, "fallback: rejected");
+    Check(sink.packets.empty(), "fallback: nothing recorded");
+
+    // A FALLBACK STILL COUNTS AGAINST THE RATE LIMIT
+    sink.reject = false;
+    queue.Push(Action::Engage, 0x01000011, 0x11);
+
+    Check(Flush(queue, &sink, 5500, fallbacks) == 0, "fallback: rate limited after a fallback");
+    Check(Flush(queue, &sink, 6000, fallbacks) == 1 && sink.packets.size() == 1, "fallback: injected once accepted");
+    Check(fallbacks.size() == 2, "fallback: no further fallbacks");
+}
+
+int main()
+{
+    CheckBuild();
+    CheckRateLimit();
+    CheckDedupeAndCapacity();
+    CheckFallback();
+
+    std::printf(failed != 0 ? "Action queue checks failed.\n" : "Action queue checks passed.\n");
+
+    return failed;
+}
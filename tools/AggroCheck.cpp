@@ -0,0 +1,177 @@
+/**
+ * Stockpile Aggro Queue Check
+ *
+ * Runs randomized push, move, remove, pop, retain and clear sequences through the aggro queue (see AggroQueue.h)
+ * next to a plain map of the queued slots, and checks after every step that both hold the same slots and that the
+ * queue's top is a closest one. Then times push and pop on a full queue.
+ *
+ * Usage:
+ *
+ *      aggrocheck [steps] [seed]
+ *
+ * Exits with 1 if the queue and the map disagree.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <random>
+
+#include "../AggroQueue.h"
+
+static uint64_t failures = 0;
+
+static void Fail(uint64_t step, const char* what)
+{
+    if (failures++ < 10)
+    {
+        std::fprintf(stderr, "Step %llu: %s\n", (unsigned long long)step, what);
+    }
+}
+
+/**
+ * @return {float} The smallest key in the map, -1 if it is empty.
+ */
+static float Closest(const std::map<uint16_t, float>& reference)
+{
+    float closest = -1;
+
+    for (const auto& [index, key] : reference)
+    {
+        if (closest < 0 || key < closest)
+        {
+            closest = key;
+        }
+    }
+
+    return closest;
+}
+
+int main(int argc, char** argv)
+{
+    const uint64_t steps = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+    const uint32_t seed = argc > 2 ? uint32_t(std::strtoul(argv[2], nullptr, 10)) : 1;
+
+    std::mt19937 random(seed);
+
+    AggroQueue queue;
+    std::map<uint16_t, float> reference;
+
+    for (uint64_t step = 0; step < steps; step++)
+    {
+        // SLOTS FROM A SMALL RANGE SO MOVES AND REPEATS ARE COMMON, AND ENOUGH OF THEM TO FILL THE QUEUE
+        const uint16_t index = uint16_t(random() % (AggroQueue::Capacity * 2));
+        const float key = float(random() % 1000) / 10.0f;
+
+        // EVERY OTHER STRETCH MOSTLY PUSHES, SO THE QUEUE FILLS UP AND PUSHING INTO A FULL ONE IS COVERED
+        const uint32_t op = step / 4096 % 2 == 0 && random() % 8 != 0 ? 0 : random() % 16;
+
+        switch (op)
+        {
+        case 0: case 1: case 2: case 3: case 4: case 5:
+        {
+            const bool full = reference.size() == AggroQueue::Capacity && !reference.contains(index);
+
+            if (queue.Push(index, key) == full)
+            {
+                Fail(step, full ? "push into a full queue accepted" : "push refused");
+            }
+
+            if (!full)
+            {
+                reference[index] = key;
+            }
+
+            break;
+        }
+        case 6: case 7: case 8:
+            queue.Remove(index);
+            reference.erase(index);
+            break;
+        case 9: case 10: case 11: case 12:
+        {
+            const float closest = Closest(reference);
+            const int popped = queue.Pop();
+
+            if (popped < 0 ? !reference.empty() : !reference.contains(uint16_t(popped)) || reference[uint16_t(popped)] != closest)
+            {
+                Fail(step, "pop did not return a closest slot");
+            }
+
+            if (popped >= 0)
+            {
+                reference.erase(uint16_t(popped));
+            }
+
+            break;
+        }
+        case 13: case 14:
+        {
+            const uint32_t drop = random() % 5;
+
+            queue.Retain([drop](uint32_t n) { return n % 5 != drop; });
+            std::erase_if(reference, [drop](const auto& entry) { return entry.first % 5 == drop; });
+            break;
+        }
+        default:
+            if (random() % 64 == 0)
+            {
+                queue.Clear();
+                reference.clear();
+            }
+            break;
+        }
+
+        if (queue.Size() != reference.size())
+        {
+            Fail(step, "size differs");
+            break;
+        }
+
+        const int top = queue.Top();
+
+        if (top < 0 ? !reference.empty() : !reference.contains(uint16_t(top)) || reference[uint16_t(top)] != Closest(reference))
+        {
+            Fail(step, "top is not a closest slot");
+        }
+
+        if (queue.Contains(index) != reference.contains(index))
+        {
+            Fail(step, "contains differs");
+        }
+    }
+
+    std::printf("%llu steps, %llu failures\n", (unsigned long long)steps, (unsigned long long)failures);
+
+    // TIMING, A FULL QUEUE POPPED EMPTY AND REFILLED
+    std::uniform_real_distribution<float> distance(0.0f, 50.0f);
+
+    uint64_t operations = 0;
+    uint64_t checksum = 0;
+
+    const auto start = std::chrono::steady_clock::now();
+
+    for (uint32_t round = 0; round < 20000; round++)
+    {
+        for (uint16_t n = 0; n < AggroQueue::Capacity; n++)
+        {
+            queue.Push(uint16_t(n * 17 % EntityTracker::Count), distance(random));
+        }
+
+        while (queue.Size() != 0)
+        {
+            checksum += uint64_t(queue.Pop());
+        }
+
+        operations += AggroQueue::Capacity * 2;
+    }
+
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::printf("%.1f ns per push or pop at %u queued (checksum %llx)\n", seconds * 1e9 / double(operations), AggroQueue::Capacity, (unsigned long long)checksum);
+
+    return failures != 0;
+}
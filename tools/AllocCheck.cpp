@@ -0,0 +1,883 @@
+/**
+ * Stockpile Allocation Check
+ *
+ * Runs the SDK free part of the plugin's frame path, render thread and worker, over N frames of replayed input and
+ * counts every global operator new once it is in steady state. Steady state botting must not allocate, so a single
+ * allocation fails the check.
+ *
+ * The packet handlers (PacketHandlers.h) and every helper class are the plugin's own. The frame around them is a
+ * model of Stockpile::Direct3DBeginScene and Stockpile::Decide, kept by hand: the entity diff and candidates, the
+ * chat lines classified between frames and applied after the entities, the decisions applied, key commands
+ * formatted into the tick arena, the action queue with its chat command fallback, the reaction tracer and the
+ * snapshot published to the worker, which syncs the aggro queue, searches the marked candidates, advances its
+ * timers, steers and queues its decision back. The game side is a small simulated camp of mobs the bot fights.
+ *
+ * A change to the plugin's frame that this model does not make is not checked, Stockpile::CheckAllocations reports
+ * those in debug builds.
+ *
+ * Usage:
+ *
+ *      alloccheck [capture.spcap] [frames]
+ *
+ * Without a capture (or with "-") the packets are synthesized from the simulation. Exits with 1 if anything
+ * allocated after the warm up.
+ */
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <list>
+#include <new>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../Actions.h"
+#include "../AggroQueue.h"
+#include "../Allocations.h"
+#include "../BotState.h"
+#include "../ChatClassifier.h"
+#include "../Control.h"
+#include "../EntityTracker.h"
+#include "../Matcher.h"
+#include "../Histogram.h"
+#include "../PacketCapture.h"
+#include "../PacketHandlers.h"
+#include "../PacketLayouts.h"
+#include "../ReactionTracer.h"
+#include "../SpscQueue.h"
+#include "../Steering.h"
+#include "../TickArena.h"
+#include "../TimerWheel.h"
+#include "../TripleBuffer.h"
+
+// COUNTS EVERY ALLOCATION AGAINST THE CURRENT SUBSYSTEM, THE SAME AS THE PLUGIN'S DEBUG BUILDS
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+static std::array<uint64_t, size_t(Subsystem::Count)> counts{};
+static Subsystem current = Subsystem::None;
+
+void* operator new(std::size_t size)
+{
+    counts[size_t(current)]++;
+
+    if (void* p = std::malloc(size ? size : 1))
+    {
+        return p;
+    }
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+class Scope final
+{
+    Subsystem previous;
+
+public:
+    explicit Scope(Subsystem subsystem)
+        : previous(current)
+    {
+        current = subsystem;
+    }
+    ~Scope(void)
+    {
+        current = previous;
+    }
+};
+
+static constexpr uint64_t FrameMs = 16;
+static constexpr uint32_t WarmUpFrames = 300;  // The same as Stockpile::CheckAllocations.
+static constexpr uint32_t MobCount = 300;
+static constexpr uint32_t FirstMob = 0x100;
+static constexpr uint32_t PlayerIndex = 0x400;
+static constexpr uint32_t PlayerServer = 0x01000400;
+
+static const char* MobNames[] = { "Goblin Thug", "Goblin Pathfinder", "Land Crab", "Moogle", "Bee Soldier", "Orcish Fodder" };
+
+// CHAT MODES, SEE tools/ChatBench.cpp
+static constexpr int32_t Battle = 36;
+static constexpr int32_t System = 123;
+static constexpr int32_t Party = 13;
+
+struct ChatLine
+{
+    int32_t mode;
+    const char* line;
+};
+
+// ONE A FRAME, THE LAST ONE ONLY EVERY UnreachableEvery FRAMES
+static constexpr ChatLine ChatLines[] =
+{
+    { Battle, "Bob hits the Goblin Thug for 123 points of damage." },
+    { Battle, "The Goblin Thug hits Bob for 45 points of damage." },
+    { System, "The Goblin Thug is too far away." },
+    { Party, "(Bob) the Goblin Thug was defeated lol" },
+    { System, "You cannot see the Goblin Thug." },
+};
+
+static constexpr uint32_t UnreachableEvery = 500;
+
+static const char* MobName(uint32_t index)
+{
+    return MobNames[(index - FirstMob) % std::size(MobNames)];
+}
+
+/**
+ * The game: a camp of mobs circling their spawn points, and the player.
+ */
+struct World
+{
+    struct Mob
+    {
+        uint32_t server_id;
+        float cx;
+        float cy;
+        float angle;
+        uint8_t hp;
+        uint8_t status;
+        uint32_t claim_id;
+        bool present;
+        uint32_t timer;                 // Frames until it despawns once dead, or respawns once despawned.
+    };
+
+    std::array<Mob, MobCount> mobs{};
+    float x = 0;
+    float y = 0;
+    float heading = 0;
+    uint32_t kills = 0;
+    int32_t killed = -1;                // The mob killed this step, for its defeat line.
+
+    World(void)
+    {
+        for (uint32_t n = 0; n < MobCount; n++)
+        {
+            mobs[n] = Mob{ 0x01000000 + FirstMob + n, float(n % 20) * 8.0f - 80.0f, float(n / 20) * 8.0f - 60.0f, float(n), 100, 0, 0, true, 0 };
+        }
+    }
+
+    float X(const Mob& m) const { return m.cx + 2.0f * std::cos(m.angle); }
+    float Y(const Mob& m) const { return m.cy + 2.0f * std::sin(m.angle); }
+
+    void Step(uint8_t keys, int32_t fighting)
+    {
+        heading += (keys & 0x04 ? 0.05f : 0) - (keys & 0x08 ? 0.05f : 0);
+
+        const float step = (keys & 0x02 ? 0.2f : 0) - (keys & 0x01 ? 0.1f : 0);
+
+        x += step * std::cos(heading);
+        y -= step * std::sin(heading);
+
+        killed = -1;
+
+        for (uint32_t n = 0; n < MobCount; n++)
+        {
+            Mob& m = mobs[n];
+
+            if (!m.present)
+            {
+                if (--m.timer == 0)
+                {
+                    m = Mob{ m.server_id + 0x10000, m.cx, m.cy, m.angle, 100, 0, 0, true, 0 };
+                }
+
+                continue;
+            }
+
+            if (m.hp == 0)
+            {
+                if (--m.timer == 0)
+                {
+                    m.present = false;
+                    m.timer = 120;
+                }
+
+                continue;
+            }
+
+            m.angle += 0.01f;
+
+            // THE BOT'S TARGET TAKES DAMAGE ONCE IT IS CLOSE
+            if (int32_t(FirstMob + n) == fighting && std::hypot(X(m) - x, Y(m) - y) < 4.0f)
+            {
+                m.claim_id = PlayerServer;
+                m.hp = m.hp > 2 ? uint8_t(m.hp - 2) : 0;
+
+                if (m.hp == 0)
+                {
+                    m.status = 3;
+                    m.timer = 60;
+                    kills++;
+                    killed = int32_t(FirstMob + n);
+                }
+            }
+        }
+    }
+};
+
+/**
+ * The plugin side of a frame, everything Direct3DBeginScene and the worker touch that is not game memory.
+ */
+class Frame final
+{
+public:
+    struct Settings
+    {
+        float range_new_target = 25.0f;
+        float range_engage = 19.0f;
+        float range_attacking = 2.5f;
+        float tolerance_yaw = 0.25f;
+    };
+
+    struct Snapshot
+    {
+        uint64_t tick_ms;
+        float x;
+        float y;
+        float heading;
+        EntityTracker::Handle invalidated;
+        EntityTracker::Frame entities;
+    };
+
+    struct Decision
+    {
+        uint8_t keys;
+        int select_id;
+        int engage_id;
+        int closest_target_id;
+        BotState state;
+        uint64_t snapshot_ms;
+    };
+
+    /**
+     * Counts the injected packets instead of sending them. Every FailEvery-th injection fails, so the chat command
+     * fallback runs too.
+     */
+    class Sink final : public IActionSink
+    {
+    public:
+        static constexpr uint32_t FailEvery = 3;
+
+        uint32_t calls = 0;
+        uint32_t injected = 0;
+
+        bool Inject(uint16_t id, uint32_t size, uint8_t* data) override
+        {
+            if (++calls % FailEvery == 0)
+            {
+                return false;
+            }
+
+            injected += id == ActionRequest::Id && size == ActionRequest::Size && data != nullptr;
+            return true;
+        }
+    };
+
+    Settings settings;
+
+    // RENDER THREAD
+    TickArena tick_arena{ 16 * 1024 };
+    EntityTracker entities;
+    Matcher matcher;
+    std::array<uint8_t, EntityTracker::Count> mobs_class{};
+    ChatClassifier chat_classifier;
+    ActionQueue actions;
+    Sink sink;
+    ReactionTracer reactions;
+    Histogram decide_us;
+    uint32_t acquired = 0;
+    uint32_t sent = 0;
+    std::list<Control> controls
+    {
+        Control("numpad2", false, false),
+        Control("numpad8", false, false),
+        Control("left", false, false),
+        Control("right", false, false),
+    };
+    std::array<const char*, 64> commands{};
+    uint32_t command_count = 0;
+    EntityTracker::Handle invalidated;
+    Decision decided{ 0, -1, -1, -1, BotState::Idle, 0 };
+    uint8_t keys = 0;
+    uint32_t chat_events = 0;
+    EntityTracker::Handle defeat_handle;
+    uint64_t defeat_until_ms = 0;
+    uint32_t out_of_range_count = 0;
+    uint32_t fallbacks = 0;
+
+    // WORKER
+    TripleBuffer<Snapshot> snapshots;
+    SpscQueue<Decision, 16> decisions;
+    TimerWheel<> timers;
+    AggroQueue aggro;
+    Steering steering;
+    int closest_target_id = -1;
+    EntityTracker::Handle closest_target_handle;
+    bool attack_ready = true;
+    uint32_t decisions_dropped = 0;
+
+    static constexpr uint64_t DefeatConfirmMs = 2000;  // The same as Stockpile.
+
+    enum TimerEvent : uint32_t
+    {
+        TimerAttackReady,
+    };
+
+    Frame(void)
+    {
+        const std::vector<std::string> selected = { "Goblin*", "*Crab", "Bee*" };
+        const std::vector<std::string> bans = { ",", ".", "#", "Moogle" };
+
+        matcher.Compile(selected, bans);
+        timers.Start(0);
+    }
+
+    // THE CONTEXT OF THE PACKET HANDLERS
+    int ClosestTarget() const { return decided.closest_target_id; }
+    int NextTarget() const { return -1; }
+    uint32_t PlayerServerId() const { return PlayerServer; }
+    EntityTracker& Entities() { return entities; }
+
+    void InvalidateTarget(int index, const char* source, const char* reason)
+    {
+        Command(tick_arena.Format("Target {} invalidated by {}. ({})", index, source, reason));
+
+        invalidated = entities.MakeHandle(index);
+        entities.Mark(uint32_t(index), false);
+        entities.SetAggro(uint32_t(index), false);
+        decided.closest_target_id = -1;
+    }
+
+    void InvalidateNext(int, const char*) {}
+
+    void ObserveEngage(uint16_t index)
+    {
+        reactions.Observe(Reaction::CommandToPacket, decided.snapshot_ms, [index](const ReactionTracer::Pending& p) { return p.target == index; });
+    }
+
+    void Command(const char* command)
+    {
+        commands[command_count++ % commands.size()] = command;
+    }
+
+    /**
+     * Stockpile::OnChatLine, a line the game wrote between frames.
+     */
+    void OnChatLine(int32_t mode, const char* message)
+    {
+        if (decided.closest_target_id == -1)
+        {
+            return;
+        }
+
+        uint32_t events = chat_classifier.Classify(mode, message);
+
+        if ((events & ChatClassifier::Defeat) && std::strstr(message, MobName(uint32_t(decided.closest_target_id))) == nullptr)
+        {
+            events &= ~ChatClassifier::Defeat;
+        }
+
+        chat_events |= events;
+    }
+
+    /**
+     * Stockpile::ApplyChatEvents, without the unreachable marks: an unreachable target is only dropped.
+     */
+    void ApplyChatEvents(uint64_t now)
+    {
+        const uint32_t events = chat_events;
+        const int index = decided.closest_target_id;
+
+        chat_events = ChatClassifier::None;
+
+        if (index == -1)
+        {
+            defeat_until_ms = 0;
+            return;
+        }
+
+        if (defeat_until_ms != 0 && (defeat_handle.index != index || entities.IsStale(defeat_handle) || now >= defeat_until_ms))
+        {
+            defeat_until_ms = 0;
+        }
+
+        if ((events & ChatClassifier::Defeat) && defeat_until_ms == 0)
+        {
+            defeat_handle = entities.MakeHandle(index);
+            defeat_until_ms = now + DefeatConfirmMs;
+        }
+
+        if (defeat_until_ms != 0)
+        {
+            const EntityTracker::Entry& e = entities.Get(uint32_t(index));
+
+            if (e.hp == 0 || e.status == 2 || e.status == 3)
+            {
+                defeat_until_ms = 0;
+                InvalidateTarget(index, "chat", "defeated");
+                return;
+            }
+        }
+
+        if (events & (ChatClassifier::CannotSee | ChatClassifier::CannotAttack))
+        {
+            InvalidateTarget(index, "chat", "unreachable");
+            return;
+        }
+
+        if (events & (ChatClassifier::TooFar | ChatClassifier::OutOfRange))
+        {
+            out_of_range_count++;
+        }
+    }
+
+    void UpdateEntities(const World& world)
+    {
+        for (uint32_t index = 0; index < EntityTracker::Count; index++)
+        {
+            entities.Next(index) = {};
+        }
+
+        EntityTracker::Entry& player = entities.Next(PlayerIndex);
+        player.present = true;
+        player.server_id = PlayerServer;
+        player.spawn_flags = 0x0D;
+
+        for (uint32_t n = 0; n < MobCount; n++)
+        {
+            const World::Mob& m = world.mobs[n];
+
+            if (!m.present)
+            {
+                continue;
+            }
+
+            EntityTracker::Entry& e = entities.Next(FirstMob + n);
+
+            e = EntityTracker::Entry{ world.X(m), world.Y(m), 0, m.server_id, m.claim_id, m.hp, m.status, 0x10, true };
+        }
+
+        entities.Diff();
+
+        entities.ForEachDirty([&](uint32_t index, uint8_t changes)
+        {
+            const EntityTracker::Entry& e = entities.Get(index);
+
+            if (changes & EntityTracker::Spawned)
+            {
+                mobs_class[index] = e.spawn_flags == 0x10 ? matcher.Classify(MobName(index)) : uint8_t(Matcher::None);
+            }
+
+            if (changes & EntityTracker::Despawned)
+            {
+                mobs_class[index] = uint8_t(Matcher::None);
+            }
+
+            const bool alive = e.present && e.spawn_flags == 0x10 && e.hp > 0 && e.status != 2 && e.status != 3;
+
+            entities.Mark(index, alive && (mobs_class[index] & Matcher::Selected));
+            entities.SetAggro(index, alive && e.claim_id == PlayerServer);
+        });
+    }
+
+    /**
+     * Direct3DBeginScene, up to publishing the snapshot.
+     */
+    void Render(const World& world, uint64_t now, const std::vector<Capture::Record>& packets)
+    {
+        tick_arena.Reset();
+
+        {
+            Scope scope(Subsystem::Packets);
+
+            for (const Capture::Record& r : packets)
+            {
+                Dispatch(r);
+            }
+        }
+
+        {
+            Scope scope(Subsystem::Entities);
+
+            UpdateEntities(world);
+            ApplyChatEvents(now);
+
+            reactions.Observe(Reaction::Move, now, [&](const ReactionTracer::Pending& p) { return p.x != world.x || p.y != world.y; });
+            reactions.Observe(Reaction::Turn, now, [&](const ReactionTracer::Pending& p) { return p.heading != world.heading; });
+            reactions.Expire(now);
+        }
+
+        {
+            Scope scope(Subsystem::Targeting);
+
+            decisions.Drain([&](const Decision& decision)
+            {
+                keys = decision.keys;
+
+                if (decision.engage_id != -1)
+                {
+                    actions.Push(Action::Engage, entities.Get(uint32_t(decision.engage_id)).server_id, uint16_t(decision.engage_id));
+                    reactions.Emit(Reaction::EngagePacket, now, decision.engage_id);
+                }
+
+                if (decision.closest_target_id != decided.closest_target_id && decision.closest_target_id != -1)
+                {
+                    acquired++;
+                }
+
+                decide_us.Add(50);
+                reactions.Add(Reaction::Decide, now - decision.snapshot_ms);
+
+                decided = decision;
+            });
+        }
+
+        {
+            Scope scope(Subsystem::Controls);
+
+            uint8_t key = 0x01;
+
+            for (std::list<Control>::iterator it = controls.begin(); it != controls.end(); ++it, key <<= 1)
+            {
+                it->SetC(keys & key);
+
+                if (it->GetC() && !it->GetO())
+                {
+                    Command(tick_arena.Format("/sendkey {} down", it->GetControl()));
+                    it->SetO(true);
+
+                    reactions.Emit(key & 0x0C ? Reaction::Turn : Reaction::Move, now, -1, world.x, world.y, world.heading);
+                }
+
+                if (!it->GetC() && it->GetO())
+                {
+                    Command(tick_arena.Format("/sendkey {} up", it->GetControl()));
+                    it->SetO(false);
+                }
+            }
+        }
+
+        {
+            Scope scope(Subsystem::Actions);
+
+            // CHAT COMMANDS ARE THE FALLBACK WHEN THE INJECTION FAILS
+            sent += actions.Flush(&sink, now, [&](const ActionQueue::Entry& entry)
+            {
+                fallbacks++;
+
+                switch (entry.action)
+                {
+                case Action::Engage:
+                    Command("/attack");
+                    break;
+                case Action::Disengage:
+                    Command("/attack off");
+                    break;
+                default:
+                    break;
+                }
+            });
+        }
+
+        Snapshot& s = snapshots.Back();
+
+        s.tick_ms = now;
+        s.x = world.x;
+        s.y = world.y;
+        s.heading = world.heading;
+        s.invalidated = invalidated;
+        s.entities = entities.Current();
+
+        snapshots.Publish();
+    }
+
+    /**
+     * Stockpile::Decide, reduced to what touches memory: aggro sync, closest search, timers, steering.
+     */
+    void Decide()
+    {
+        Scope scope(Subsystem::Targeting);
+
+        if (!snapshots.Acquire())
+        {
+            return;
+        }
+
+        const Snapshot& s = snapshots.Front();
+        Decision decision{ 0, -1, -1, -1, BotState::Acquire, s.tick_ms };
+
+        timers.Advance(s.tick_ms, [&](uint32_t event)
+        {
+            if (event == TimerAttackReady)
+            {
+                attack_ready = true;
+            }
+        });
+
+        aggro.Retain([&](uint32_t index) { return s.entities.IsAggro(index); });
+
+        s.entities.ForEachAggro([&](uint32_t index)
+        {
+            const EntityTracker::Entry& e = s.entities.Get(index);
+
+            aggro.Push(uint16_t(index), std::hypot(e.x - s.x, e.y - s.y));
+        });
+
+        // DROP A DEAD, DESPAWNED OR INVALIDATED TARGET
+        if (closest_target_id != -1)
+        {
+            const EntityTracker::Entry& e = s.entities.Get(uint32_t(closest_target_id));
+            const bool invalidated = closest_target_handle.index == s.invalidated.index && closest_target_handle.generation == s.invalidated.generation;
+
+            if (invalidated || s.entities.IsStale(closest_target_handle) || e.hp == 0 || e.status == 3)
+            {
+                closest_target_id = -1;
+            }
+        }
+
+        if (closest_target_id == -1)
+        {
+            closest_target_id = aggro.Pop();
+
+            if (closest_target_id == -1)
+            {
+                float distance_best = settings.range_new_target * 4;
+
+                s.entities.ForEachMarked([&](uint32_t index)
+                {
+                    const EntityTracker::Entry& e = s.entities.Get(index);
+                    const float distance = std::sqrt((e.x - s.x) * (e.x - s.x) + (e.y - s.y) * (e.y - s.y));
+
+                    if (distance <= distance_best)
+                    {
+                        distance_best = distance;
+                        closest_target_id = int(index);
+                    }
+                });
+            }
+
+            closest_target_handle = s.entities.MakeHandle(closest_target_id);
+            steering.Reset();
+        }
+
+        if (closest_target_id != -1)
+        {
+            const EntityTracker::Entry& e = s.entities.Get(uint32_t(closest_target_id));
+
+            float difference = std::atan2(-(e.y - s.y), e.x - s.x) - s.heading;
+            difference = std::remainder(difference, 2.0f * float(M_PI));
+
+            const float distance = std::hypot(e.x - s.x, e.y - s.y);
+            const int32_t turn = steering.Turn(difference, distance, s.heading, settings.tolerance_yaw, s.tick_ms);
+
+            decision.keys |= turn < 0 ? 0x08 : turn > 0 ? 0x04 : 0;
+            decision.keys |= steering.Approach(distance, settings.range_attacking) ? 0x02 : 0;
+            decision.state = distance < settings.range_engage ? BotState::Engage : BotState::Approach;
+
+            if (distance < settings.range_engage && attack_ready)
+            {
+                decision.engage_id = closest_target_id;
+                attack_ready = false;
+                timers.Schedule(TimerAttackReady, 3000);
+            }
+        }
+
+        decision.closest_target_id = closest_target_id;
+
+        if (!decisions.Push(decision))
+        {
+            decisions_dropped++;
+        }
+    }
+
+private:
+    void Dispatch(const Capture::Record& record);
+};
+
+void Frame::Dispatch(const Capture::Record& record)
+{
+    if (record.direction == Capture::Incoming)
+    {
+        IncomingPackets<Frame>(*this, record.id, record.data, record.size);
+    }
+    else
+    {
+        OutgoingPackets<Frame>(*this, record.id, record.data, record.size);
+    }
+}
+
+/**
+ * Packets the game would send this frame: an update for one mob, and an attack on the player now and then.
+ */
+static void Synthesize(const World& world, uint32_t frame, std::array<std::array<uint8_t, 0x40>, 2>& buffers, std::vector<Capture::Record>& packets)
+{
+    const uint32_t n = (frame * 7) % MobCount;
+    const World::Mob& m = world.mobs[n];
+
+    uint8_t* update = buffers[0].data();
+    ::memset(update, 0, buffers[0].size());
+
+    PacketWrite<EntityUpdate, EntityUpdate::ServerId>(update, m.server_id);
+    PacketWrite<EntityUpdate, EntityUpdate::Index>(update, uint16_t(FirstMob + n));
+    PacketWrite<EntityUpdate, EntityUpdate::Mask>(update, uint8_t((m.present ? 0 : EntityUpdate::MaskDespawn) | EntityUpdate::MaskStatus | EntityUpdate::MaskClaim));
+    PacketWrite<EntityUpdate, EntityUpdate::HPPercent>(update, m.hp);
+    PacketWrite<EntityUpdate, EntityUpdate::Status>(update, m.status);
+    PacketWrite<EntityUpdate, EntityUpdate::ClaimId>(update, m.claim_id);
+
+    packets.push_back(Capture::Record{ frame * FrameMs * 1000, Capture::Incoming, 0, EntityUpdate::Id, uint16_t(EntityUpdate::Size), update });
+
+    if (frame % 30 == 0)
+    {
+        uint8_t* message = buffers[1].data();
+        ::memset(message, 0, buffers[1].size());
+
+        PacketWrite<ActionMessage, ActionMessage::ActorId>(message, m.server_id);
+        PacketWrite<ActionMessage, ActionMessage::TargetId>(message, PlayerServer);
+        PacketWrite<ActionMessage, ActionMessage::ActorIndex>(message, uint16_t(FirstMob + n));
+        PacketWrite<ActionMessage, ActionMessage::TargetIndex>(message, uint16_t(PlayerIndex));
+        PacketWrite<ActionMessage, ActionMessage::Message>(message, 1);
+
+        packets.push_back(Capture::Record{ frame * FrameMs * 1000, Capture::Incoming, 0, ActionMessage::Id, uint16_t(ActionMessage::Size), message });
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const bool replay = argc > 1 && std::string_view(argv[1]) != "-";
+    const uint32_t frames = argc > 2 ? uint32_t(std::max(1L, std::strtol(argv[2], nullptr, 10))) : 10000;
+
+    // THE WHOLE CAPTURE IS LOADED BEFORE ANYTHING IS COUNTED
+    CaptureReader reader;
+    std::vector<Capture::Record> records;
+
+    if (replay)
+    {
+        if (!reader.Open(argv[1]))
+        {
+            std::fprintf(stderr, "Not a capture, or a capture of another version: %s\n", argv[1]);
+            return 2;
+        }
+
+        Capture::Record record{};
+
+        while (reader.Next(record))
+        {
+            records.push_back(record);
+        }
+
+        if (records.empty())
+        {
+            std::fprintf(stderr, "Capture has no packets: %s\n", argv[1]);
+            return 2;
+        }
+    }
+
+    World world;
+    Frame* frame = new Frame;
+
+    std::array<std::string, std::size(MobNames)> defeats;
+
+    for (size_t n = 0; n < defeats.size(); n++)
+    {
+        defeats[n] = std::string("Bob defeats the ") + MobNames[n] + ".";
+    }
+
+    std::vector<Capture::Record> packets;
+    packets.reserve(4096);
+
+    std::array<std::array<uint8_t, 0x40>, 2> buffers{};
+    size_t next_record = 0;
+    const uint64_t capture_start = replay ? records.front().time_us : 0;
+    uint64_t capture_offset = 0;
+
+    std::array<uint64_t, size_t(Subsystem::Count)> warm{};
+    uint64_t warm_kills = 0;
+
+    for (uint32_t n = 0; n < WarmUpFrames + frames; n++)
+    {
+        if (n == WarmUpFrames)
+        {
+            warm = counts;
+            warm_kills = world.kills;
+        }
+
+        const uint64_t now = 1000 + uint64_t(n) * FrameMs;
+
+        // THIS FRAME'S PACKETS, A CAPTURE REPLAYS IN ITS OWN TIME AND WRAPS AROUND
+        packets.clear();
+
+        if (replay)
+        {
+            const uint64_t until = uint64_t(n + 1) * FrameMs * 1000;
+
+            while (packets.size() < packets.capacity() && records[next_record].time_us - capture_start + capture_offset < until)
+            {
+                packets.push_back(records[next_record]);
+
+                if (++next_record == records.size())
+                {
+                    next_record = 0;
+                    capture_offset += records.back().time_us - capture_start + FrameMs * 1000;
+                }
+            }
+        }
+        else
+        {
+            Synthesize(world, n, buffers, packets);
+        }
+
+        // THE GAME'S CHAT LINES, WRITTEN BETWEEN FRAMES THE SAME AS ITS PACKETS
+        const ChatLine& chat = ChatLines[n % UnreachableEvery == 0 ? std::size(ChatLines) - 1 : n % (std::size(ChatLines) - 1)];
+
+        frame->OnChatLine(chat.mode, chat.line);
+
+        if (world.killed != -1)
+        {
+            frame->OnChatLine(Battle, defeats[(uint32_t(world.killed) - FirstMob) % std::size(MobNames)].c_str());
+        }
+
+        frame->Render(world, now, packets);
+        frame->Decide();
+
+        world.Step(frame->keys, frame->decided.closest_target_id);
+    }
+
+    uint64_t total = 0;
+
+    std::printf("%u frames after %u warm up frames, %llu kills, %u packets injected, %u chat command fallbacks, %u decisions dropped, %zu arena bytes peak\n\n", frames, WarmUpFrames, (unsigned long long)(world.kills - warm_kills), frame->sink.injected, frame->fallbacks, frame->decisions_dropped, frame->tick_arena.Peak());
+    std::printf("%-10s %12s\n", "subsystem", "allocations");
+
+    for (size_t n = 0; n < size_t(Subsystem::Count); n++)
+    {
+        const uint64_t count = counts[n] - warm[n];
+
+        std::printf("%-10s %12llu\n", SubsystemNames[n], (unsigned long long)count);
+        total += count;
+    }
+
+    delete frame;
+
+    if (total != 0)
+    {
+        std::printf("\nFAILED: %llu steady state allocations.\n", (unsigned long long)total);
+        return 1;
+    }
+
+    std::printf("\nOK: no steady state allocations.\n");
+
+    return 0;
+}
@@ -0,0 +1,185 @@
+/**
+ * Stockpile Chat Classifier Benchmark
+ *
+ * Checks the chat classifier (see ChatClassifier.h) against a set of known lines, including lines players typed that
+ * must be ignored, then classifies a chat log in whole passes for at least the given time and reports the throughput
+ * and the events found per pass.
+ *
+ * Usage:
+ *
+ *      chatbench [chat.log] [seconds]
+ *
+ * Ashita writes the logs to <install>/chatlogs. Without a log a synthetic one is generated. Exits with 1 if a known
+ * line is misclassified.
+ */
+
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../ChatClassifier.h"
+
+// CHAT MODES THE KNOWN LINES ARRIVE WITH
+static constexpr int32_t Battle = 36;
+static constexpr int32_t System = 123;
+static constexpr int32_t Party = 13;
+static constexpr int32_t Linkshell = 14;
+static constexpr int32_t Tell = 12;
+
+struct Known
+{
+    int32_t mode;
+    const char* line;
+    uint32_t events;
+};
+
+static constexpr Known KnownLines[] =
+{
+    { System, "You cannot see the Goblin Thug.", ChatClassifier::CannotSee },
+    { System, "You are unable to see the Goblin Thug.", ChatClassifier::CannotSee },
+    { System, "The Goblin Thug is too far away.", ChatClassifier::TooFar },
+    { System, "Target out of range.", ChatClassifier::OutOfRange },
+    { System, "You CANNOT ATTACK that target.", ChatClassifier::CannotAttack },
+    { Battle, "Bob defeats the Goblin Thug.", ChatClassifier::Defeat },
+    { Battle, "The Goblin Thug was defeated by Bob.", ChatClassifier::Defeat },
+    { Battle, "\x1e\x01The Crab falls to the ground.", ChatClassifier::Defeat },
+    { Battle, "Bob hits the Goblin Thug for 123 points of damage.", ChatClassifier::None },
+    { System, "cannot sefoo", ChatClassifier::None },
+    { System, "", ChatClassifier::None },
+
+    // TYPED BY PLAYERS, NEVER AN EVENT
+    { Party, "(Bob) I cannot see it, cannot attack from here", ChatClassifier::None },
+    { Linkshell, "<Bob> the Goblin Thug was defeated lol", ChatClassifier::None },
+    { Tell, "Bob>> you are too far away", ChatClassifier::None },
+    { 0x0100 | Party, "(Bob) cannot see", ChatClassifier::None },
+};
+
+static const char* EventNames[] = { "cannot see", "too far", "out of range", "cannot attack", "defeat" };
+
+static std::string Synthesize()
+{
+    static const char* lines[] =
+    {
+        "Bob hits the Goblin Thug for 123 points of damage.",
+        "The Goblin Thug hits Bob for 45 points of damage.",
+        "Bob misses the Goblin Thug.",
+        "Bob uses Fast Blade.",
+        "The Goblin Thug is too far away.",
+        "Bob defeats the Goblin Thug.",
+        "Bob gains 120 experience points.",
+        "You cannot see the Goblin Thug.",
+    };
+
+    std::string log;
+
+    for (uint32_t n = 0; n < 100000; n++)
+    {
+        // MOSTLY DAMAGE, THE EVENTS ARE RARE IN A REAL LOG TOO
+        log += lines[n % 16 < 10 ? n % 4 : 4 + n % 4];
+        log += '\n';
+    }
+
+    return log;
+}
+
+int main(int argc, char** argv)
+{
+    const ChatClassifier classifier;
+
+    int failed = 0;
+
+    for (const Known& known : KnownLines)
+    {
+        const uint32_t events = classifier.Classify(known.mode, known.line);
+
+        if (events != known.events)
+        {
+            std::fprintf(stderr, "Misclassified: %d \"%s\" 0x%02X, expected 0x%02X\n", known.mode, known.line, events, known.events);
+            failed = 1;
+        }
+    }
+
+    std::string log;
+
+    if (argc > 1)
+    {
+        std::ifstream file(argv[1], std::ios::binary);
+
+        if (!file)
+        {
+            std::fprintf(stderr, "Cannot read: %s\n", argv[1]);
+            return 1;
+        }
+
+        log.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+    else
+    {
+        log = Synthesize();
+    }
+
+    const double duration = argc > 2 ? std::max(0.1, std::strtod(argv[2], nullptr)) : 1.0;
+
+    std::vector<std::string_view> lines;
+
+    for (size_t start = 0; start < log.size();)
+    {
+        size_t end = log.find('\n', start);
+
+        if (end == std::string::npos)
+        {
+            end = log.size();
+        }
+
+        lines.emplace_back(log.data() + start, end - start);
+        start = end + 1;
+    }
+
+    if (lines.empty())
+    {
+        std::fprintf(stderr, "Chat log is empty.\n");
+        return 1;
+    }
+
+    // WHOLE PASSES OVER THE LOG, SO EVERY LINE IS WEIGHTED THE SAME
+    std::array<uint64_t, 8> counts{};
+    uint64_t classified = 0;
+
+    const auto start = std::chrono::steady_clock::now();
+    auto elapsed = std::chrono::steady_clock::duration::zero();
+
+    while (std::chrono::duration<double>(elapsed).count() < duration)
+    {
+        for (const std::string_view line : lines)
+        {
+            for (uint32_t bits = classifier.Classify(line); bits != 0; bits &= bits - 1)
+            {
+                counts[std::countr_zero(bits)]++;
+            }
+        }
+
+        classified += lines.size();
+        elapsed = std::chrono::steady_clock::now() - start;
+    }
+
+    const double seconds = std::chrono::duration<double>(elapsed).count();
+    const uint64_t passes = classified / lines.size();
+
+    std::printf("%zu lines x %llu passes\n", lines.size(), (unsigned long long)passes);
+    std::printf("%.0f lines/s, %.1f MB/s, %.1f ns/line\n\n", double(classified) / seconds, double(log.size()) * double(passes) / seconds / 1e6, seconds * 1e9 / double(classified));
+
+    for (size_t n = 0; n < std::size(EventNames); n++)
+    {
+        std::printf("%-14s %llu\n", EventNames[n], (unsigned long long)(counts[n] / passes));
+    }
+
+    return failed;
+}
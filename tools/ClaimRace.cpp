@@ -0,0 +1,202 @@
+/**
+ * Stockpile Claim Table Race Test (POSIX)
+ *
+ * Forks several processes that open the same shared claim table (see ClaimTable.h) and race Reserve on the same key,
+ * round after round, released in lock step through a barrier in shared memory:
+ *
+ *  - Race: every process reserves the round's key at once, exactly one may win.
+ *  - Release: the winner releases it and every other process races again, exactly one of them may win.
+ *
+ * Usage:
+ *
+ *      claimrace [processes] [rounds]
+ *
+ * Exits with 1 if a round had no winner or more than one.
+ */
+
+#if defined(_WIN32)
+#error "ClaimRace forks, it only builds on POSIX systems. The Windows mapping is the same table."
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "../ClaimTable.h"
+
+static constexpr uint32_t MaxProcesses = ClaimTable::Owners;
+static constexpr uint32_t Phases = 2;
+
+/**
+ * Shared between the parent and every child, mapped before forking.
+ */
+struct Race
+{
+    std::atomic<uint32_t> arrived;
+    std::atomic<uint32_t> generation;
+    std::atomic<uint32_t> failed_open;
+    std::atomic<uint8_t> won[1][MaxProcesses];  // Rounds * Phases rows follow in the same mapping.
+};
+
+static uint64_t Now()
+{
+    return uint64_t(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+/**
+ * Sense reversing barrier, spinning. Every process waits until all have arrived.
+ */
+static void Barrier(Race& race, uint32_t processes)
+{
+    const uint32_t generation = race.generation.load();
+
+    if (race.arrived.fetch_add(1) + 1 == processes)
+    {
+        race.arrived.store(0);
+        race.generation.fetch_add(1);
+        return;
+    }
+
+    while (race.generation.load() == generation)
+    {
+    }
+}
+
+static std::atomic<uint8_t>* Row(Race& race, uint32_t round, uint32_t phase)
+{
+    return race.won[0] + size_t(round * Phases + phase) * MaxProcesses;
+}
+
+static int Child(Race& race, const char* name, uint32_t me, uint32_t processes, uint32_t rounds)
+{
+    ClaimTable claims;
+
+    if (!claims.Open(name, Now()))
+    {
+        race.failed_open.fetch_add(1);
+    }
+
+    Barrier(race, processes);
+
+    for (uint32_t round = 0; round < rounds; round++)
+    {
+        // A FRESH KEY EVERY ROUND, SPREAD OVER ZONES AND INDEXES SO THE PROBE WINDOWS OVERLAP
+        const uint32_t zone = round % 1024;
+        const uint32_t index = (round * 7) % 4096;
+
+        Barrier(race, processes);
+
+        const bool won = claims.Reserve(zone, index, ClaimTable::Intent, Now());
+        Row(race, round, 0)[me].store(won);
+
+        Barrier(race, processes);
+
+        // THE WINNER LETS GO, EVERYONE ELSE RACES FOR IT AGAIN
+        if (won)
+        {
+            claims.Release(zone, index);
+        }
+
+        Barrier(race, processes);
+
+        if (!won)
+        {
+            Row(race, round, 1)[me].store(claims.Reserve(zone, index, ClaimTable::Intent, Now()));
+        }
+
+        Barrier(race, processes);
+
+        claims.Release(zone, index);
+    }
+
+    claims.Close();
+
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    const uint32_t processes = argc > 1 ? std::clamp(uint32_t(std::strtoul(argv[1], nullptr, 10)), 2u, MaxProcesses) : 4;
+    const uint32_t rounds = argc > 2 ? std::max(1u, uint32_t(std::strtoul(argv[2], nullptr, 10))) : 1000;
+
+    const std::string name = "/stockpile_claimrace_" + std::to_string(::getpid());
+    const size_t size = sizeof(Race) + size_t(rounds) * Phases * MaxProcesses;
+
+    void* view = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+
+    if (view == MAP_FAILED)
+    {
+        std::perror("mmap");
+        return 2;
+    }
+
+    Race& race = *new (view) Race{};
+
+    for (uint32_t me = 0; me < processes; me++)
+    {
+        const pid_t pid = ::fork();
+
+        if (pid == 0)
+        {
+            ::_exit(Child(race, name.c_str(), me, processes, rounds));
+        }
+
+        if (pid < 0)
+        {
+            std::perror("fork");
+            return 2;
+        }
+    }
+
+    int status = 0;
+    bool crashed = false;
+
+    for (uint32_t me = 0; me < processes; me++)
+    {
+        ::wait(&status);
+        crashed |= !WIFEXITED(status) || WEXITSTATUS(status) != 0;
+    }
+
+    ::shm_unlink(name.c_str());
+
+    if (crashed || race.failed_open.load() != 0)
+    {
+        std::fprintf(stderr, "A process crashed or could not open the claim table.\n");
+        return 1;
+    }
+
+    uint32_t failures = 0;
+
+    for (uint32_t round = 0; round < rounds; round++)
+    {
+        for (uint32_t phase = 0; phase < Phases; phase++)
+        {
+            uint32_t winners = 0;
+
+            for (uint32_t me = 0; me < processes; me++)
+            {
+                winners += Row(race, round, phase)[me].load();
+            }
+
+            if (winners != 1 && failures++ < 10)
+            {
+                std::fprintf(stderr, "Round %u %s: %u winners.\n", round, phase == 0 ? "race" : "after release", winners);
+            }
+        }
+    }
+
+    std::printf("%u processes, %u rounds x %u races, %u failures\n", processes, rounds, Phases, failures);
+
+    ::munmap(view, size);
+
+    return failures != 0;
+}
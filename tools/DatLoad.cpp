@@ -0,0 +1,275 @@
+/**
+ * Stockpile Zone Mob DAT Load Benchmark
+ *
+ * Loads a synthetic zone mob DAT the way Stockpile::LoadMobDatData and Stockpile::DecodeNames do (see MobTable.h and
+ * NameArena.h), and the way the plugin did before the name arena, one trimmed std::string per record sorted and
+ * uniqued at the end. Reports the time and the heap allocations per load for both.
+ *
+ * The DAT holds 0x20 byte records, a space padded name and the server id. Names repeat the way camps do, and some are
+ * the common bans.
+ *
+ * Usage:
+ *
+ *      datload [records] [seconds]
+ *
+ * Exits with 1 if both loads do not find the same names, or if the allocations per load grow with the record count.
+ */
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../Matcher.h"
+#include "../MobTable.h"
+#include "../NameArena.h"
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+static uint64_t allocations = 0;
+
+void* operator new(std::size_t size)
+{
+    allocations++;
+
+    if (void* p = std::malloc(size ? size : 1))
+    {
+        return p;
+    }
+
+    throw std::bad_alloc();
+}
+
+// THE POLYMORPHIC ALLOCATORS' DEFAULT RESOURCE ALLOCATES ALIGNED
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    allocations++;
+
+    const size_t align = std::max(sizeof(void*), size_t(alignment));
+
+    if (void* p = std::aligned_alloc(align, (std::max<size_t>(size, 1) + align - 1) / align * align))
+    {
+        return p;
+    }
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::align_val_t) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept
+{
+    std::free(p);
+}
+
+// THE SAME LISTS Stockpile.h STARTS WITH
+static const std::vector<std::string> CommonBans = { "???", "", "none", "EFFECTER" };
+static const std::vector<std::string> PotentialBans = { ",", ".", "#", "Moogle" };
+
+static std::vector<char> Synthesize(uint32_t records)
+{
+    static const char* stems[] = { "Goblin", "Orcish", "Yagudo", "Quadav", "Land", "Bee", "Forest", "Cave", "Giant", "Mad" };
+    static const char* kinds[] = { "Thug", "Pathfinder", "Fodder", "Crab", "Soldier", "Hare", "Bat", "Leech", "Worm", "Bats" };
+
+    std::vector<char> dat(size_t(records) * MobTable::RecordSize, 0);
+
+    for (uint32_t n = 0; n < records; n++)
+    {
+        char* record = dat.data() + size_t(n) * MobTable::RecordSize;
+        char name[MobTable::NameSize + 1]{};
+
+        // MOSTLY CAMPS OF THE SAME FEW HUNDRED NAMES, SOME BANS AND SOME PADDED
+        switch (n % 16)
+        {
+        case 0:
+            std::snprintf(name, sizeof(name), "???");
+            break;
+        case 1:
+            std::snprintf(name, sizeof(name), "none");
+            break;
+        case 2:
+            std::snprintf(name, sizeof(name), "  %s %s  ", stems[n / 16 % 10], kinds[n / 160 % 10]);
+            break;
+        default:
+            std::snprintf(name, sizeof(name), "%s %s %u", stems[n % 10], kinds[n / 10 % 10], n / 100 % 5);
+            break;
+        }
+
+        std::memset(record, ' ', MobTable::NameSize);
+        std::memcpy(record, name, std::strlen(name));
+        record[MobTable::NameSize - 1] = '\0';
+
+        const uint32_t server_id = 0x01000000 | (0x64 << 12) | (n % MobTable::Slots);
+        std::memcpy(record + MobTable::NameSize, &server_id, sizeof(server_id));
+    }
+
+    return dat;
+}
+
+/**
+ * The load before the name arena, from the baseline LoadMobDatData.
+ */
+static std::vector<std::string> LoadStrings(const std::vector<char>& dat)
+{
+    std::vector<std::string> unique_names;
+
+    auto contains_find = [](std::vector<std::string> vec, std::string search)
+    {
+        return std::find(vec.begin(), vec.end(), search) != vec.end();
+    };
+
+    for (size_t offset = 0; offset < dat.size(); offset += MobTable::RecordSize)
+    {
+        std::string name(dat.data() + offset, ::strnlen(dat.data() + offset, MobTable::NameSize));
+
+        name.erase(name.begin(), std::find_if(name.begin(), name.end(), [](unsigned char ch) { return !std::isspace(ch); }));
+        name.erase(std::find_if(name.rbegin(), name.rend(), [](unsigned char ch) { return !std::isspace(ch); }).base(), name.end());
+
+        if (!contains_find(CommonBans, name))
+        {
+            unique_names.push_back(name);
+        }
+    }
+
+    std::sort(unique_names.begin(), unique_names.end());
+    unique_names.erase(std::unique(unique_names.begin(), unique_names.end()), unique_names.end());
+
+    return unique_names;
+}
+
+/**
+ * The load now: one read into the mob table, indexed and classified, then the names decoded into the arena.
+ */
+static void LoadTable(const std::vector<char>& dat, const Matcher& matcher, MobTable& table, NameArena& names)
+{
+    char* records = table.Prepare(dat.size());
+    std::memcpy(records, dat.data(), dat.size());
+
+    table.Index([](std::string_view name) { return std::find(CommonBans.begin(), CommonBans.end(), name) != CommonBans.end(); });
+    table.Classify(matcher);
+
+    names.Reserve(table.NameCount(), table.NameCount() * MobTable::NameSize);
+
+    for (size_t n = 0; n < table.NameCount(); n++)
+    {
+        names.Add(table.NameAt(uint16_t(n)));
+    }
+
+    names.Sort();
+}
+
+struct Result
+{
+    double us;
+    uint64_t allocations;
+};
+
+template <typename F>
+static Result Measure(double duration, F&& load)
+{
+    const uint64_t before = allocations;
+    load();
+    const uint64_t first = allocations - before;
+
+    uint64_t loads = 0;
+
+    const auto start = std::chrono::steady_clock::now();
+    auto elapsed = std::chrono::steady_clock::duration::zero();
+
+    do
+    {
+        load();
+        loads++;
+        elapsed = std::chrono::steady_clock::now() - start;
+    } while (std::chrono::duration<double>(elapsed).count() < duration);
+
+    return Result{ std::chrono::duration<double, std::micro>(elapsed).count() / double(loads), first };
+}
+
+int main(int argc, char** argv)
+{
+    const uint32_t records = argc > 1 ? std::max(1u, uint32_t(std::strtoul(argv[1], nullptr, 10))) : 10000;
+    const double duration = argc > 2 ? std::max(0.1, std::strtod(argv[2], nullptr)) : 1.0;
+
+    Matcher matcher;
+    matcher.Compile({ "Goblin*", "*Crab*", "Bee Soldier 2" }, PotentialBans);
+
+    int failed = 0;
+
+    // THE SAME NAMES BOTH WAYS
+    const std::vector<char> dat = Synthesize(records);
+    const std::vector<std::string> expected = LoadStrings(dat);
+
+    MobTable table;
+    NameArena names;
+    LoadTable(dat, matcher, table, names);
+
+    bool same = names.size() == expected.size();
+
+    for (size_t n = 0; same && n < names.size(); n++)
+    {
+        same = names[n] == expected[n];
+    }
+
+    if (!same)
+    {
+        std::fprintf(stderr, "The mob table found %zu names, the string load %zu.\n", names.size(), expected.size());
+        failed = 1;
+    }
+
+    std::printf("%u records, %zu unique names, %u slots\n\n", records, names.size(), MobTable::Slots);
+
+    // A FRESH TABLE EVERY LOAD, THE SAME AS A ZONE CHANGE
+    auto load_table = [&](const std::vector<char>& input)
+    {
+        return [&]
+        {
+            MobTable zone_table;
+            NameArena zone_names;
+            LoadTable(input, matcher, zone_table, zone_names);
+        };
+    };
+
+    const Result strings = Measure(duration, [&] { LoadStrings(dat); });
+    const Result arena = Measure(duration, load_table(dat));
+
+    std::printf("strings     %9.1f us/load %8llu allocations/load\n", strings.us, (unsigned long long)strings.allocations);
+    std::printf("name arena  %9.1f us/load %8llu allocations/load\n", arena.us, (unsigned long long)arena.allocations);
+
+    // THE ALLOCATIONS MUST NOT DEPEND ON THE RECORD COUNT
+    for (const uint32_t count : { 100u, 1000u, records * 2 })
+    {
+        const std::vector<char> other = Synthesize(count);
+        const Result result = Measure(0, load_table(other));
+
+        if (result.allocations != arena.allocations)
+        {
+            std::fprintf(stderr, "%u records: %llu allocations/load, %u records: %llu.\n", count, (unsigned long long)result.allocations, records, (unsigned long long)arena.allocations);
+            failed = 1;
+        }
+    }
+
+    return failed;
+}
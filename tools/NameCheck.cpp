@@ -0,0 +1,183 @@
+/**
+ * Stockpile Name Index Check
+ *
+ * Runs random searches through the name index (see NameIndex.h) and through a plain case insensitive substring scan
+ * of every name, the way FilterTargets searched before the index, over synthetic zones, and checks that both return
+ * the same names in the same order. Reports the time of both per query and the size of the index.
+ *
+ * The searches: parts of names in any case, and random strings that mostly match nothing.
+ *
+ * Usage:
+ *
+ *      namecheck [zones] [names] [seed]
+ *
+ * Names are drawn at random for every zone, the repeats are dropped, so a zone ends up with fewer unique names.
+ *
+ * Exits with 1 if the index returned different names than the scan.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../NameArena.h"
+#include "../NameIndex.h"
+
+static char Lower(char c)
+{
+    return c >= 'A' && c <= 'Z' ? char(c - 'A' + 'a') : c;
+}
+
+/**
+ * The search before the index, every name lower cased and searched.
+ */
+static void Scan(const NameArena& names, std::string_view query, std::vector<uint32_t>& found)
+{
+    std::string needle(query);
+    std::string name;
+
+    std::transform(needle.begin(), needle.end(), needle.begin(), Lower);
+
+    for (size_t id = 0; id < names.size(); id++)
+    {
+        name.assign(names[id]);
+        std::transform(name.begin(), name.end(), name.begin(), Lower);
+
+        if (name.find(needle) != std::string::npos)
+        {
+            found.push_back(uint32_t(id));
+        }
+    }
+}
+
+static std::string Name(std::mt19937& random)
+{
+    static const char* parts[] = { "Goblin", "Thug", "Crab", "Bee", "Orcish", "Lord", "Tiger", "Bat", "Worm", "Sea", "Bogy", "Yagudo", "Acolyte", "Quadav", "Mage", "Land", "Forest", "Hare", "Leech", "Giant" };
+
+    std::string name = parts[random() % 20];
+
+    for (uint32_t words = random() % 3; words > 0; words--)
+    {
+        name += random() % 8 == 0 ? "-" : " ";
+        name += parts[random() % 20];
+    }
+
+    return name;
+}
+
+static std::string Query(const NameArena& names, std::mt19937& random)
+{
+    std::string query;
+
+    if (random() % 4 == 0)
+    {
+        // RANDOM LETTERS, MOSTLY NOT IN ANY NAME
+        for (uint32_t length = 1 + random() % 6; length > 0; length--)
+        {
+            query += char('a' + random() % 26);
+        }
+    }
+    else
+    {
+        // PART OF A NAME
+        const std::string_view name = names[random() % names.size()];
+        const size_t at = random() % name.size();
+
+        query = name.substr(at, 1 + random() % (name.size() - at));
+    }
+
+    for (char& c : query)
+    {
+        c = random() % 2 == 0 ? c : c >= 'a' && c <= 'z' ? char(c - 'a' + 'A') : Lower(c);
+    }
+
+    return query.substr(0, NameIndex::MaxQuery);
+}
+
+int main(int argc, char** argv)
+{
+    const uint32_t zones = argc > 1 ? std::max(1u, uint32_t(std::strtoul(argv[1], nullptr, 10))) : 50;
+    const uint32_t count = argc > 2 ? std::clamp(uint32_t(std::strtoul(argv[2], nullptr, 10)), 1u, 4096u) : 800;
+    const uint32_t seed = argc > 3 ? uint32_t(std::strtoul(argv[3], nullptr, 10)) : 1;
+
+    std::mt19937 random(seed);
+
+    uint64_t queries = 0;
+    uint64_t mismatches = 0;
+    uint64_t matches = 0;
+    size_t names_total = 0;
+    size_t bytes = 0;
+    double index_us = 0;
+    double scan_us = 0;
+
+    std::vector<uint32_t> indexed;
+    std::vector<uint32_t> scanned;
+
+    for (uint32_t zone = 0; zone < zones; zone++)
+    {
+        // THE ZONE'S UNIQUE NAMES, THE SAME AS DecodeNames
+        std::vector<std::string> source;
+        size_t characters = 0;
+
+        for (uint32_t n = 0; n < count; n++)
+        {
+            source.push_back(Name(random));
+            characters += source.back().size();
+        }
+
+        std::sort(source.begin(), source.end());
+        source.erase(std::unique(source.begin(), source.end()), source.end());
+
+        NameArena names;
+        names.Reserve(source.size(), characters);
+
+        for (const std::string& name : source)
+        {
+            names.Add(name);
+        }
+
+        names.Sort();
+
+        NameIndex index;
+        index.Build(names);
+
+        names_total += names.size();
+        bytes += index.bytes();
+
+        for (uint32_t n = 0; n < 2000; n++)
+        {
+            const std::string query = Query(names, random);
+
+            indexed.clear();
+            scanned.clear();
+
+            auto start = std::chrono::steady_clock::now();
+            index.Query(query, [&indexed](uint32_t id) { indexed.push_back(id); });
+            index_us += std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+            start = std::chrono::steady_clock::now();
+            Scan(names, query, scanned);
+            scan_us += std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+
+            if (indexed != scanned && mismatches++ < 10)
+            {
+                std::fprintf(stderr, "Zone %u: \"%s\" found %zu names, the scan %zu.\n", zone, query.c_str(), indexed.size(), scanned.size());
+            }
+
+            matches += scanned.size();
+            queries++;
+        }
+    }
+
+    std::printf("%u zones, %.0f names per zone, %llu queries, %.1f matches per query, %llu mismatches\n", zones, double(names_total) / zones, (unsigned long long)queries, double(matches) / double(queries), (unsigned long long)mismatches);
+    std::printf("index %7.2f us/query, %zu KB per zone\n", index_us / double(queries), bytes / zones / 1024);
+    std::printf("scan  %7.2f us/query\n", scan_us / double(queries));
+
+    return mismatches != 0;
+}
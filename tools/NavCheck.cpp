@@ -0,0 +1,246 @@
+/**
+ * Stockpile Navigation Check
+ *
+ * Builds the navigation grid (see NavGrid.h) from a synthetic zone mesh and checks the paths it finds, then
+ * benchmarks the query latency.
+ *
+ * The mesh is a 100 x 100 yalm floor with:
+ *
+ *  - a wall across x = 50 from y = 0 to y = 80, paths must go around its end,
+ *  - a platform 10 yalms up with no way onto it,
+ *  - a bridge deck 5 yalms up over the floor, reached by a ramp at either end.
+ *
+ * Usage:
+ *
+ *      navcheck [queries]
+ *
+ * Exits with 1 if a check failed.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <random>
+#include <vector>
+
+#include "../NavGrid.h"
+
+using Point = NavGrid::Point;
+
+static int failed = 0;
+
+static void Check(bool condition, const char* what)
+{
+    if (!condition)
+    {
+        std::fprintf(stderr, "Failed: %s\n", what);
+        failed = 1;
+    }
+}
+
+/**
+ * Triangle soup of the synthetic zone.
+ */
+struct Mesh
+{
+    std::vector<Point> vertices;
+    std::vector<uint32_t> indices;
+
+    void Quad(const Point& a, const Point& b, const Point& c, const Point& d)
+    {
+        const uint32_t first = uint32_t(vertices.size());
+
+        vertices.insert(vertices.end(), { a, b, c, d });
+        indices.insert(indices.end(), { first, first + 1, first + 2, first, first + 2, first + 3 });
+    }
+};
+
+static Mesh Zone()
+{
+    Mesh mesh;
+
+    // FLOOR
+    mesh.Quad({ 0, 0, 0 }, { 100, 0, 0 }, { 100, 100, 0 }, { 0, 100, 0 });
+
+    // WALL
+    mesh.Quad({ 50, 0, 0 }, { 50, 80, 0 }, { 50, 80, 5 }, { 50, 0, 5 });
+
+    // PLATFORM
+    mesh.Quad({ 70, 10, 10 }, { 90, 10, 10 }, { 90, 30, 10 }, { 70, 30, 10 });
+
+    // BRIDGE, RAMP UP, DECK, RAMP DOWN
+    mesh.Quad({ 55, 40, 0 }, { 65, 40, 5 }, { 65, 46, 5 }, { 55, 46, 0 });
+    mesh.Quad({ 65, 40, 5 }, { 85, 40, 5 }, { 85, 46, 5 }, { 65, 46, 5 });
+    mesh.Quad({ 85, 40, 5 }, { 95, 40, 0 }, { 95, 46, 0 }, { 85, 46, 5 });
+
+    return mesh;
+}
+
+/**
+ * Whether the path from `from` through the waypoints crosses the wall, sampled every 0.1 yalm.
+ */
+static bool CrossesWall(const Point& from, const std::vector<Point>& path)
+{
+    Point previous = from;
+
+    for (const Point& p : path)
+    {
+        for (uint32_t n = 0; n <= 100; n++)
+        {
+            const float t = float(n) / 100.0f;
+            const float x = previous.x + (p.x - previous.x) * t;
+            const float y = previous.y + (p.y - previous.y) * t;
+
+            if (std::abs(x - 50.0f) < 0.05f && y < 80.0f)
+            {
+                return true;
+            }
+        }
+
+        previous = p;
+    }
+
+    return false;
+}
+
+static void CheckPaths(const NavGrid& grid)
+{
+    NavGrid::Query query;
+    std::vector<Point> path;
+
+    // OPEN FLOOR, STRAIGHT TO THE GOAL
+    Check(grid.FindPath(query, { 10, 10, 0 }, { 40, 60, 0 }, path), "open floor: found");
+    Check(path.size() == 1 && path.back().x == 40 && path.back().y == 60, "open floor: no waypoints");
+
+    // AROUND THE END OF THE WALL
+    Check(grid.FindPath(query, { 40, 20, 0 }, { 60, 20, 0 }, path), "wall: found");
+    Check(path.size() > 1, "wall: detours");
+    Check(!CrossesWall({ 40, 20, 0 }, path), "wall: does not cross");
+    Check(std::any_of(path.begin(), path.end(), [](const Point& p) { return p.y >= 80; }), "wall: goes around its end");
+
+    // NO WAY UP, BUT WALKABLE ONCE ON IT
+    Check(!grid.FindPath(query, { 60, 20, 0 }, { 80, 20, 10 }, path), "platform: unreachable from the floor");
+    Check(grid.FindPath(query, { 75, 15, 10 }, { 85, 25, 10 }, path), "platform: walkable on top");
+
+    // UNDER THE BRIDGE ON THE FLOOR LAYER, STRAIGHT
+    Check(grid.FindPath(query, { 75, 35, 0 }, { 75, 52, 0 }, path), "under bridge: found");
+    Check(path.size() == 1, "under bridge: straight");
+
+    // FROM THE DECK DOWN TO THE FLOOR BELOW IT, BY A RAMP
+    Check(grid.FindPath(query, { 75, 43, 5 }, { 75, 50, 0 }, path), "bridge: deck to floor found");
+    Check(std::any_of(path.begin(), path.end(), [](const Point& p) { return p.x <= 66 || p.x >= 84; }), "bridge: takes a ramp");
+
+    // OFF THE GRID
+    Check(!grid.FindPath(query, { -20, 50, 0 }, { 40, 50, 0 }, path), "off grid: start");
+    Check(!grid.FindPath(query, { 40, 50, 0 }, { 40, 50, 30 }, path), "off grid: no layer near the goal height");
+}
+
+static void CheckWindowAndCancel()
+{
+    Mesh mesh;
+    mesh.Quad({ 0, 0, 0 }, { 400, 0, 0 }, { 400, 10, 0 }, { 0, 10, 0 });
+
+    NavGrid grid;
+    NavGrid::Query query;
+    std::vector<Point> path;
+    std::atomic<bool> cancel{ false };
+
+    Check(grid.Build(mesh.vertices, mesh.indices, cancel), "window: build");
+    Check(grid.FindPath(query, { 5, 5, 0 }, { 200, 5, 0 }, path), "window: inside");
+    Check(!grid.FindPath(query, { 5, 5, 0 }, { 395, 5, 0 }, path), "window: ends too far apart");
+
+    cancel = true;
+
+    Check(!NavGrid().Build(mesh.vertices, mesh.indices, cancel), "cancel: build gives up");
+}
+
+static void CheckSaveLoad(const NavGrid& grid)
+{
+    const std::filesystem::path file = std::filesystem::temp_directory_path() / "navcheck.nav";
+
+    NavGrid loaded;
+    NavGrid::Query query;
+    std::vector<Point> expected;
+    std::vector<Point> path;
+
+    Check(grid.Save(file.string().c_str()), "save");
+    Check(loaded.Load(file.string().c_str()), "load");
+    Check(loaded.Width() == grid.Width() && loaded.Height() == grid.Height() && loaded.Bytes() == grid.Bytes(), "load: size");
+
+    grid.FindPath(query, { 40, 20, 0 }, { 60, 20, 0 }, expected);
+    loaded.FindPath(query, { 40, 20, 0 }, { 60, 20, 0 }, path);
+
+    Check(path.size() == expected.size() && std::equal(path.begin(), path.end(), expected.begin(), [](const Point& a, const Point& b)
+    {
+        return a.x == b.x && a.y == b.y && a.z == b.z;
+    }), "load: same path");
+
+    std::filesystem::remove(file);
+}
+
+int main(int argc, char** argv)
+{
+    const uint32_t queries = argc > 1 ? std::max(1u, uint32_t(std::strtoul(argv[1], nullptr, 10))) : 10000;
+
+    const Mesh mesh = Zone();
+    std::atomic<bool> cancel{ false };
+    NavGrid grid;
+
+    const auto build_start = std::chrono::steady_clock::now();
+    const bool built = grid.Build(mesh.vertices, mesh.indices, cancel);
+    const double build_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - build_start).count();
+
+    Check(built, "build");
+
+    if (!built)
+    {
+        return 1;
+    }
+
+    std::printf("grid: %u x %u, %zu bytes, built in %.2f ms\n", grid.Width(), grid.Height(), grid.Bytes(), build_ms);
+
+    CheckPaths(grid);
+    CheckWindowAndCancel();
+    CheckSaveLoad(grid);
+
+    // LATENCY, RANDOM FLOOR POINTS ON BOTH SIDES OF THE WALL SO MOST QUERIES DETOUR
+    std::mt19937 random(1);
+    std::uniform_real_distribution<float> side(5.0f, 45.0f);
+    std::uniform_real_distribution<float> across(0.0f, 100.0f);
+
+    NavGrid::Query query;
+    std::vector<Point> path;
+    std::vector<double> latencies;
+    uint32_t found = 0;
+
+    path.reserve(64);
+    latencies.reserve(queries);
+
+    for (uint32_t n = 0; n < queries; n++)
+    {
+        const Point from{ side(random), across(random) * 0.6f, 0 };
+        const Point to{ 100.0f - side(random), across(random) * 0.6f, 0 };
+
+        const auto start = std::chrono::steady_clock::now();
+        found += grid.FindPath(query, from, to, path);
+        latencies.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count());
+    }
+
+    std::sort(latencies.begin(), latencies.end());
+
+    double total = 0;
+
+    for (const double latency : latencies)
+    {
+        total += latency;
+    }
+
+    std::printf("queries: %u, %u found\n", queries, found);
+    std::printf("latency: mean %.1f us, p50 %.1f us, p99 %.1f us, max %.1f us\n", total / queries, latencies[queries / 2], latencies[size_t(queries * 0.99)], latencies.back());
+
+    return failed;
+}
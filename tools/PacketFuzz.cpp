@@ -0,0 +1,213 @@
+/**
+ * Stockpile Packet Fuzzer
+ *
+ * Feeds random packet ids, sizes and bytes through the plugin's packet handlers and their dispatch tables (see
+ * PacketHandlers.h), then benchmarks the dispatch.
+ *
+ *  - Fuzz: every packet is copied into a heap buffer of exactly its size, so a read past the end is caught by the
+ *    address sanitizer. Truncated packets (shorter than their layout) must never reach a handler, and oversized and
+ *    exact ones always must. Unknown ids must not dispatch.
+ *  - Benchmark: dispatches a fixed mix of valid packets for at least the given time, and reports packets per second.
+ *
+ * Usage:
+ *
+ *      packetfuzz [iterations] [seconds] [seed]
+ *
+ * Exits with 1 if a packet was dispatched when it should not have been, or not when it should.
+ */
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "../EntityTracker.h"
+#include "../PacketHandlers.h"
+
+/**
+ * The plugin's state, as far as the packet handlers read it. Every incoming handler asks for the target first and
+ * every engage request is observed, so the calls count the handlers reached.
+ */
+class FuzzContext final
+{
+public:
+    static constexpr int Target = 0x100;
+
+    uint64_t calls = 0;
+    uint64_t invalidations = 0;
+    EntityTracker entities;
+
+    int ClosestTarget()
+    {
+        calls++;
+        return Target;
+    }
+
+    int NextTarget() const { return Target + 1; }
+    uint32_t PlayerServerId() const { return 0x01000400; }
+    EntityTracker& Entities() { return entities; }
+
+    void InvalidateTarget(int, const char*, const char*) { invalidations++; }
+    void InvalidateNext(int, const char*) { invalidations++; }
+    void ObserveEngage(uint16_t) { calls++; }
+};
+
+/**
+ * Points a packet of at least its layout size at the context's targets, so the rules past the index check are read
+ * too, and makes every request an engage.
+ */
+static void Aim(bool incoming, uint16_t id, uint8_t* data, std::mt19937& random)
+{
+    const uint16_t index = uint16_t(FuzzContext::Target + random() % 3);
+
+    if (incoming && id == EntityUpdate::Id)
+    {
+        PacketWrite<EntityUpdate, EntityUpdate::Index>(data, index);
+    }
+    else if (incoming && id == ActionMessage::Id)
+    {
+        PacketWrite<ActionMessage, ActionMessage::TargetIndex>(data, index);
+    }
+    else if (!incoming && id == ActionRequest::Id)
+    {
+        PacketWrite<ActionRequest, ActionRequest::Category>(data, 0x02);
+    }
+}
+
+/**
+ * @return {uint32_t} The layout size of a handled id, 0 if the table has no handler for it.
+ */
+static uint32_t LayoutSize(bool incoming, uint16_t id)
+{
+    if (incoming)
+    {
+        return id == EntityUpdate::Id ? EntityUpdate::Size : id == ActionMessage::Id ? ActionMessage::Size : 0;
+    }
+
+    return id == ActionRequest::Id ? ActionRequest::Size : 0;
+}
+
+int main(int argc, char** argv)
+{
+    const uint64_t iterations = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+    const double duration = argc > 2 ? std::max(0.1, std::strtod(argv[2], nullptr)) : 1.0;
+    const uint32_t seed = argc > 3 ? uint32_t(std::strtoul(argv[3], nullptr, 10)) : 1;
+
+    std::mt19937 random(seed);
+    FuzzContext context;
+
+    static constexpr uint16_t Handled[] = { EntityUpdate::Id, ActionMessage::Id, ActionRequest::Id };
+
+    uint64_t failures = 0;
+    uint64_t truncated = 0;
+    uint64_t dispatched = 0;
+
+    for (uint64_t n = 0; n < iterations; n++)
+    {
+        const bool incoming = random() & 1;
+
+        // MOSTLY HANDLED IDS, SO THE SIZE CHECK IS WHAT GETS EXERCISED, THE REST ANY 16 BIT ID
+        const uint16_t id = random() % 4 != 0 ? Handled[random() % std::size(Handled)] : uint16_t(random());
+        const uint32_t layout = LayoutSize(incoming, id);
+
+        // TRUNCATED, EXACT OR OVERSIZED UP TO TWICE THE LARGEST PACKET
+        uint32_t size = 0;
+
+        switch (random() % 4)
+        {
+        case 0:
+            size = layout != 0 ? uint32_t(random() % layout) : 0;
+            break;
+        case 1:
+            size = layout;
+            break;
+        default:
+            size = uint32_t(random() % 0x400);
+            break;
+        }
+
+        std::unique_ptr<uint8_t[]> buffer(size != 0 ? new uint8_t[size] : nullptr);
+
+        for (uint32_t b = 0; b < size; b++)
+        {
+            buffer[b] = uint8_t(random());
+        }
+
+        if (layout != 0 && size >= layout)
+        {
+            Aim(incoming, id, buffer.get(), random);
+        }
+
+        const uint64_t before = context.calls;
+        const bool found = incoming ? IncomingPackets<FuzzContext>(context, id, buffer.get(), size) : OutgoingPackets<FuzzContext>(context, id, buffer.get(), size);
+        const bool handled = context.calls != before;
+
+        const bool should_find = layout != 0;
+        const bool should_handle = should_find && size >= layout;
+
+        if (found != should_find || handled != should_handle)
+        {
+            if (failures++ < 10)
+            {
+                std::fprintf(stderr, "%s 0x%03X size %u: found %d handled %d, expected %d %d\n", incoming ? "in" : "out", id, size, found, handled, should_find, should_handle);
+            }
+        }
+
+        truncated += should_find && size < layout;
+        dispatched += handled;
+    }
+
+    std::printf("fuzz: %llu packets, %llu dispatched, %llu truncated rejected, %llu failures\n", (unsigned long long)iterations, (unsigned long long)dispatched, (unsigned long long)truncated, (unsigned long long)failures);
+
+    // BENCHMARK, A FIXED MIX OF VALID PACKETS
+    struct Packet
+    {
+        bool incoming;
+        uint16_t id;
+        uint32_t size;
+        std::array<uint8_t, 0x40> data;
+    };
+
+    std::vector<Packet> mix(4096);
+
+    for (Packet& p : mix)
+    {
+        p.incoming = random() % 4 != 0;
+        p.id = p.incoming ? (random() & 1 ? EntityUpdate::Id : ActionMessage::Id) : ActionRequest::Id;
+        p.size = LayoutSize(p.incoming, p.id);
+
+        for (uint8_t& b : p.data)
+        {
+            b = uint8_t(random());
+        }
+
+        Aim(p.incoming, p.id, p.data.data(), random);
+    }
+
+    uint64_t total = 0;
+
+    const auto start = std::chrono::steady_clock::now();
+    auto elapsed = std::chrono::steady_clock::duration::zero();
+
+    while (std::chrono::duration<double>(elapsed).count() < duration)
+    {
+        for (const Packet& p : mix)
+        {
+            p.incoming ? IncomingPackets<FuzzContext>(context, p.id, p.data.data(), p.size) : OutgoingPackets<FuzzContext>(context, p.id, p.data.data(), p.size);
+        }
+
+        total += mix.size();
+        elapsed = std::chrono::steady_clock::now() - start;
+    }
+
+    const double seconds = std::chrono::duration<double>(elapsed).count();
+
+    std::printf("dispatch: %.0f packets/s, %.2f ns/packet (%llu invalidations)\n", double(total) / seconds, seconds * 1e9 / double(total), (unsigned long long)context.invalidations);
+
+    return failures != 0;
+}
@@ -0,0 +1,192 @@
+/**
+ * Stockpile Reaction Tracer Check
+ *
+ * Checks the reaction tracer's bookkeeping (see ReactionTracer.h and Histogram.h): latencies run from the first emit
+ * to the first observation, repeats keep the first emit, actions never seen are missed after the timeout or when the
+ * ring comes around, and abandoned ones are not counted.
+ *
+ * Then simulates a game that shows each action's effect a random time after it was emitted, some too late and some
+ * never, and checks the tracer measured exactly the latencies and misses the simulation knows, frame for frame.
+ *
+ * Usage:
+ *
+ *      reactioncheck [actions] [seed]
+ *
+ * Exits with 1 if a check failed.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <unordered_map>
+
+#include "../ReactionTracer.h"
+
+static int failed = 0;
+
+static void Check(bool condition, const char* what)
+{
+    if (!condition)
+    {
+        std::fprintf(stderr, "Failed: %s\n", what);
+        failed = 1;
+    }
+}
+
+static void CheckHistogram()
+{
+    Histogram h;
+
+    Check(h.Count() == 0 && h.Mean() == 0 && h.Percentile(0.5f) == 0, "histogram: empty");
+
+    for (const uint64_t ms : { 0, 1, 2, 3, 100, 1000 })
+    {
+        h.Add(ms);
+    }
+
+    Check(h.At(0) == 2 && h.At(1) == 2 && h.At(6) == 1 && h.At(9) == 1, "histogram: buckets");
+    Check(h.Count() == 6 && h.Sum() == 1106 && h.Max() == 1000 && h.Mean() == 184, "histogram: totals");
+    Check(h.Percentile(0.5f) == 4, "histogram: median bucket bound");
+    Check(h.Percentile(1.0f) == 1000, "histogram: capped at the largest sample");
+    Check(Histogram::Bucket(UINT64_MAX) == Histogram::Buckets - 1, "histogram: last bucket");
+}
+
+static void CheckTracer()
+{
+    ReactionTracer tracer;
+
+    // LATENCY FROM THE FIRST EMIT, A REPEAT FOR THE SAME TARGET IS THE SAME ACTION
+    const uint32_t first = tracer.Emit(Reaction::Select, 100, 5);
+
+    Check(tracer.Emit(Reaction::Select, 150, 5) == first, "repeat: same sequence");
+    Check(tracer.Emit(Reaction::Select, 150, 6) != first, "repeat: other target is a new action");
+    Check(tracer.Emitted(Reaction::Select) == 2, "repeat: emitted once per action");
+
+    tracer.Observe(Reaction::Select, 300, [](const ReactionTracer::Pending& p) { return p.target == 5; });
+
+    Check(tracer.Latency(Reaction::Select).Count() == 1 && tracer.Latency(Reaction::Select).Sum() == 200, "observe: latency from the first emit");
+
+    // ONLY CLOSED ONCE
+    tracer.Observe(Reaction::Select, 400, [](const ReactionTracer::Pending& p) { return p.target == 5; });
+
+    Check(tracer.Latency(Reaction::Select).Count() == 1, "observe: closed once");
+
+    // NOT SEEN IN TIME
+    tracer.Emit(Reaction::Turn, 1000, -1, 0, 0, 1.0f);
+    tracer.Expire(1000 + ReactionTracer::Timeout);
+
+    Check(tracer.Missed(Reaction::Turn) == 0, "expire: not before the timeout");
+
+    tracer.Expire(1001 + ReactionTracer::Timeout);
+
+    Check(tracer.Missed(Reaction::Turn) == 1 && tracer.Latency(Reaction::Turn).Count() == 0, "expire: missed after the timeout");
+    Check(tracer.Missed(Reaction::Select) == 1, "expire: the unseen select is missed too");
+
+    // THE RING COMES AROUND ON ACTIONS STILL PENDING
+    ReactionTracer ring;
+
+    for (int32_t n = 0; n < int32_t(ReactionTracer::Slots) + 3; n++)
+    {
+        ring.Emit(Reaction::Move, 0, n);
+    }
+
+    Check(ring.Missed(Reaction::Move) == 3, "ring: overwritten actions are missed");
+
+    // ABANDONED ACTIONS ARE NOT MISSED
+    ring.Abandon();
+    ring.Expire(ReactionTracer::Timeout * 2);
+
+    Check(ring.Missed(Reaction::Move) == 3, "abandon: not counted");
+
+    // MEASURED ELSEWHERE
+    ring.Add(Reaction::Decide, 7);
+
+    Check(ring.Emitted(Reaction::Decide) == 1 && ring.Latency(Reaction::Decide).Sum() == 7, "add: recorded");
+}
+
+/**
+ * A game that shows every action's effect some time after it was emitted, and the tracer watching it every frame.
+ */
+static void CheckSimulation(uint32_t actions, uint32_t seed)
+{
+    static constexpr uint64_t FrameMs = 16;
+
+    std::mt19937 random(seed);
+    std::uniform_int_distribution<uint64_t> delay(20, 1500);
+
+    ReactionTracer tracer;
+    std::unordered_map<uint32_t, uint64_t> effect_ms;       // Sequence -> when the game shows the effect.
+
+    uint64_t expected_sum = 0;
+    uint32_t expected_count = 0;
+    uint32_t expected_missed = 0;
+    uint32_t emitted = 0;
+
+    uint64_t now = 0;
+    uint64_t last_ms = 0;
+
+    while (emitted < actions || now <= last_ms + ReactionTracer::Timeout + FrameMs)
+    {
+        now += FrameMs;
+
+        // ABOUT ONE ACTION EVERY 400 MS, EACH AT ITS OWN TARGET, SO THE RING NEVER COMES AROUND ON A PENDING ONE
+        if (emitted < actions && random() % 25 == 0)
+        {
+            const int32_t target = int32_t(emitted % 2048);
+            const uint32_t sequence = tracer.Emit(Reaction::Select, now, target);
+
+            // SOME NEVER TAKE EFFECT, SOME TAKE LONGER THAN THE TIMEOUT
+            const bool lost = random() % 50 == 0;
+            const uint64_t shown = now + (random() % 20 == 0 ? 4000 + random() % 3000 : delay(random));
+
+            effect_ms[sequence] = lost ? UINT64_MAX : shown;
+            last_ms = now;
+            emitted++;
+
+            // SEEN ON THE FIRST FRAME AT OR AFTER THE EFFECT, UNLESS IT EXPIRED ON AN EARLIER ONE
+            const uint64_t seen = (shown + FrameMs - 1) / FrameMs * FrameMs;
+            const uint64_t expires = (now + ReactionTracer::Timeout) / FrameMs * FrameMs + FrameMs;
+
+            if (lost || seen > expires)
+            {
+                expected_missed++;
+            }
+            else
+            {
+                expected_sum += seen - now;
+                expected_count++;
+            }
+        }
+
+        tracer.Observe(Reaction::Select, now, [&](const ReactionTracer::Pending& p)
+        {
+            return effect_ms[p.sequence] <= now;
+        });
+
+        tracer.Expire(now);
+    }
+
+    const Histogram& latency = tracer.Latency(Reaction::Select);
+
+    Check(tracer.Emitted(Reaction::Select) == emitted, "simulation: emitted");
+    Check(latency.Count() == expected_count, "simulation: seen");
+    Check(latency.Sum() == expected_sum, "simulation: latencies");
+    Check(tracer.Missed(Reaction::Select) == expected_missed, "simulation: missed");
+
+    std::printf("%u actions, %u seen, %u missed, mean %llu ms, p50 <= %llu ms, p90 <= %llu ms\n", emitted, latency.Count(), tracer.Missed(Reaction::Select), (unsigned long long)latency.Mean(), (unsigned long long)latency.Percentile(0.5f), (unsigned long long)latency.Percentile(0.9f));
+}
+
+int main(int argc, char** argv)
+{
+    const uint32_t actions = argc > 1 ? uint32_t(std::strtoul(argv[1], nullptr, 10)) : 100000;
+    const uint32_t seed = argc > 2 ? uint32_t(std::strtoul(argv[2], nullptr, 10)) : 1;
+
+    CheckHistogram();
+    CheckTracer();
+    CheckSimulation(actions, seed);
+
+    std::printf(failed != 0 ? "Reaction tracer checks failed.\n" : "Reaction tracer checks passed.\n");
+
+    return failed;
+}
@@ -0,0 +1,182 @@
+/**
+ * Stockpile Packet Replayer
+ *
+ * Replays a packet capture (see PacketCapture.h) through the plugin's packet handlers (see PacketHandlers.h), at full
+ * speed and without a game client, and reports packets per second, handler time per packet id, and how often the
+ * target the player engaged was invalidated, by reason.
+ *
+ * Usage:
+ *
+ *      replay <capture.spcap> [passes] [player server id]
+ *
+ * Without a player server id every claim counts as foreign. The entities are not in the capture, so no mob is marked
+ * as aggro.
+ */
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string_view>
+#include <vector>
+
+#include "../EntityTracker.h"
+#include "../PacketCapture.h"
+#include "../PacketHandlers.h"
+
+/**
+ * The plugin's state, as far as the packet handlers read it. The target is the one the captured engage packets show,
+ * so the handlers invalidate the target the player was fighting, the same as the plugin would have.
+ */
+class ReplayContext final
+{
+public:
+    uint32_t self = 0;
+    int target = -1;
+    EntityTracker entities;
+
+    std::array<uint64_t, size_t(Invalidation::Count)> invalidations{};
+    uint64_t engages = 0;
+
+    int ClosestTarget() const { return target; }
+    int NextTarget() const { return -1; }
+    uint32_t PlayerServerId() const { return self; }
+    EntityTracker& Entities() { return entities; }
+
+    void InvalidateTarget(int, const char*, const char* reason)
+    {
+        for (size_t n = 0; n < invalidations.size(); n++)
+        {
+            invalidations[n] += std::string_view(InvalidationNames[n]) == reason;
+        }
+
+        target = -1;
+    }
+
+    void InvalidateNext(int, const char*) {}
+
+    void ObserveEngage(uint16_t index)
+    {
+        engages++;
+        target = index;
+    }
+};
+
+struct PerId
+{
+    uint64_t packets = 0;
+    uint64_t handled = 0;
+    uint64_t ns = 0;
+};
+
+static bool Dispatch(ReplayContext& context, const Capture::Record& record)
+{
+    if (record.direction == Capture::Incoming)
+    {
+        return IncomingPackets<ReplayContext>(context, record.id, record.data, record.size);
+    }
+
+    return OutgoingPackets<ReplayContext>(context, record.id, record.data, record.size);
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        std::fprintf(stderr, "Usage: %s <capture.spcap> [passes] [player server id]\n", argv[0]);
+        return 2;
+    }
+
+    const uint32_t passes = argc > 2 ? uint32_t(std::max(1L, std::strtol(argv[2], nullptr, 10))) : 10;
+
+    CaptureReader reader;
+
+    if (!reader.Open(argv[1]))
+    {
+        std::fprintf(stderr, "Not a capture, or a capture of another version: %s\n", argv[1]);
+        return 1;
+    }
+
+    // RECORDS POINT INTO THE LOADED FILE, NOTHING IS READ WHILE REPLAYING
+    std::vector<Capture::Record> records;
+    Capture::Record record{};
+
+    while (reader.Next(record))
+    {
+        records.push_back(record);
+    }
+
+    if (records.empty())
+    {
+        std::fprintf(stderr, "Capture has no packets: %s\n", argv[1]);
+        return 1;
+    }
+
+    ReplayContext context;
+    context.self = argc > 3 ? uint32_t(std::strtoul(argv[3], nullptr, 0)) : 0;
+
+    // THROUGHPUT, WHOLE PASSES WITHOUT ANY PER PACKET TIMING
+    uint64_t handled = 0;
+
+    const auto start = std::chrono::steady_clock::now();
+
+    for (uint32_t pass = 0; pass < passes; pass++)
+    {
+        for (const Capture::Record& r : records)
+        {
+            handled += Dispatch(context, r);
+        }
+    }
+
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    const uint64_t total = uint64_t(records.size()) * passes;
+
+    // HANDLER TIME PER PACKET ID, ONE MORE PASS TIMING EVERY PACKET (INCLUDES THE CLOCK READS)
+    std::array<std::array<PerId, 0x200>, 2> ids{};
+
+    for (const Capture::Record& r : records)
+    {
+        const auto before = std::chrono::steady_clock::now();
+        const bool dispatched = Dispatch(context, r);
+        const auto after = std::chrono::steady_clock::now();
+
+        PerId& id = ids[r.direction != Capture::Incoming][r.id & 0x1FF];
+
+        id.packets++;
+        id.handled += dispatched;
+        id.ns += uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(after - before).count());
+    }
+
+    const double captured = double(records.back().time_us - records.front().time_us) / 1e6;
+
+    std::printf("%zu packets, %.1f s captured, %u passes\n", records.size(), captured, passes);
+    std::printf("%.0f packets/s, %.1f ns/packet, %llu handled\n\n", double(total) / seconds, seconds * 1e9 / double(total), (unsigned long long)(handled / passes));
+
+    std::printf("%-4s %-6s %10s %10s %12s\n", "dir", "id", "packets", "handled", "ns/packet");
+
+    for (size_t direction = 0; direction < ids.size(); direction++)
+    {
+        for (size_t n = 0; n < ids[direction].size(); n++)
+        {
+            const PerId& id = ids[direction][n];
+
+            if (id.packets != 0)
+            {
+                std::printf("%-4s 0x%03zX %10llu %10llu %12.1f\n", direction == 0 ? "in" : "out", n, (unsigned long long)id.packets, (unsigned long long)id.handled, double(id.ns) / double(id.packets));
+            }
+        }
+    }
+
+    std::printf("\n");
+
+    for (size_t n = 1; n < size_t(Invalidation::Count); n++)
+    {
+        std::printf("%-10s %llu\n", InvalidationNames[n], (unsigned long long)(context.invalidations[n] / (passes + 1)));
+    }
+
+    std::printf("%-10s %llu\n", "engages", (unsigned long long)(context.engages / (passes + 1)));
+
+    return 0;
+}
@@ -0,0 +1,310 @@
+/**
+ * Stockpile Steering Simulation
+ *
+ * Drives a simulated player with the steering controller (see Steering.h) and with the bang-bang steering the plugin
+ * used before it, from the same starts, and reports the arrival time and the key transitions of both.
+ *
+ *  - Chase: closes on a random goal until stopped in range_attacking, the same as the Approach state.
+ *  - Patrol: walks a random path of nodes, the same as the Patrol state, with the pure pursuit point for Steering.
+ *
+ * The player turns at a fixed rate and walks at a fixed speed, and a key acts Lead milliseconds after it is decided,
+ * the /sendkey round trip. Every press and every release of left, right and forward counts as a transition.
+ *
+ * Usage:
+ *
+ *      steersim [runs] [seed]
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <random>
+#include <vector>
+
+#include "../Steering.h"
+
+static constexpr uint64_t FrameMs = 16;
+static constexpr uint64_t TimeoutMs = 60000;
+static constexpr float TurnRate = 3.0f;             // Radians per second.
+static constexpr float Speed = 5.0f;                // Yalms per second.
+
+// THE PLUGIN'S DEFAULT SETTINGS
+static constexpr float ToleranceYaw = 0.25f;
+static constexpr float RangeAttacking = 2.5f;
+static constexpr float RangeNextPath = 3.0f;
+
+struct Pos
+{
+    float x;
+    float y;
+};
+
+struct Keys
+{
+    int32_t turn;
+    bool forward;
+};
+
+struct Result
+{
+    double seconds;
+    double transitions;
+    double yalms;
+    bool arrived;
+};
+
+static float Wrap(float angle)
+{
+    const float pi = 3.14159265f;
+
+    while (angle > pi)
+    {
+        angle -= 2 * pi;
+    }
+
+    while (angle < -pi)
+    {
+        angle += 2 * pi;
+    }
+
+    return angle;
+}
+
+static float Distance(const Pos& a, const Pos& b)
+{
+    return std::sqrt((b.x - a.x) * (b.x - a.x) + (b.y - a.y) * (b.y - a.y));
+}
+
+/**
+ * The player, with every key delayed by Steering::Lead.
+ */
+class Player final
+{
+    std::deque<std::pair<uint64_t, Keys>> pending;
+    Keys applied{};
+    Keys decided{};
+
+public:
+    Pos pos{};
+    float heading = 0;
+    uint32_t transitions = 0;
+    float yalms = 0;
+
+    /**
+     * @return {float} Signed angle to p, positive is to the left.
+     */
+    float HeadingDifference(const Pos& p) const
+    {
+        return Wrap(std::atan2(-(p.y - pos.y), p.x - pos.x) - heading);
+    }
+
+    void Press(const Keys& keys, uint64_t now)
+    {
+        transitions += (keys.turn != decided.turn) * (decided.turn != 0 && keys.turn != 0 ? 2 : 1);
+        transitions += keys.forward != decided.forward;
+        decided = keys;
+
+        pending.emplace_back(now + Steering::Lead, keys);
+    }
+
+    void Step(uint64_t now)
+    {
+        while (!pending.empty() && pending.front().first <= now)
+        {
+            applied = pending.front().second;
+            pending.pop_front();
+        }
+
+        heading = Wrap(heading + float(applied.turn) * TurnRate * FrameMs / 1000.0f);
+
+        if (applied.forward)
+        {
+            const float step = Speed * FrameMs / 1000.0f;
+
+            pos.x += std::cos(heading) * step;
+            pos.y -= std::sin(heading) * step;
+            yalms += step;
+        }
+    }
+};
+
+/**
+ * The steering before Steering.h: turn whenever outside the tolerance, forward until in range.
+ */
+static int32_t BangBang(float heading_difference, float tolerance)
+{
+    return std::abs(heading_difference) < tolerance ? 0 : heading_difference > 0 ? 1 : -1;
+}
+
+static Result Chase(bool steer, const Pos& goal, float heading)
+{
+    Player player;
+    Steering steering;
+
+    player.heading = heading;
+
+    for (uint64_t now = FrameMs; now < TimeoutMs; now += FrameMs)
+    {
+        const float distance = Distance(player.pos, goal);
+        const float difference = player.HeadingDifference(goal);
+
+        Keys keys{};
+
+        if (steer)
+        {
+            keys.turn = steering.Turn(difference, distance, player.heading, ToleranceYaw, now);
+            keys.forward = steering.Approach(distance, RangeAttacking);
+        }
+        else
+        {
+            keys.turn = BangBang(difference, ToleranceYaw);
+            keys.forward = distance >= RangeAttacking;
+        }
+
+        // STOPPED IN RANGE, Approach COUNTS ANYTHING INSIDE ITS BAND AS IN RANGE
+        if (!keys.forward && distance < RangeAttacking + Steering::Band)
+        {
+            return Result{ double(now) / 1000, double(player.transitions), double(player.yalms), true };
+        }
+
+        player.Press(keys, now);
+        player.Step(now);
+    }
+
+    return Result{ double(TimeoutMs) / 1000, double(player.transitions), double(player.yalms), false };
+}
+
+/**
+ * The same as Stockpile::PursuitPoint, walking the path forwards.
+ */
+static Pos PursuitPoint(const Pos& player, const std::vector<Pos>& path, size_t node)
+{
+    const float lookahead = RangeNextPath * RangeNextPath + 1.0f;
+    const Pos& current = path[node];
+
+    if (Distance(player, current) >= lookahead || node + 1 >= path.size())
+    {
+        return current;
+    }
+
+    const Pos& next = path[node + 1];
+
+    const float dx = next.x - current.x, dy = next.y - current.y;
+    const float fx = current.x - player.x, fy = current.y - player.y;
+
+    const float a = dx * dx + dy * dy;
+    const float b = 2 * (fx * dx + fy * dy);
+    const float c = fx * fx + fy * fy - lookahead * lookahead;
+    const float discriminant = b * b - 4 * a * c;
+
+    if (a == 0 || discriminant < 0)
+    {
+        return current;
+    }
+
+    const float t = std::clamp((-b + std::sqrt(discriminant)) / (2 * a), 0.0f, 1.0f);
+
+    return Pos{ current.x + dx * t, current.y + dy * t };
+}
+
+static Result Patrol(bool steer, const std::vector<Pos>& path, float heading)
+{
+    Player player;
+    Steering steering;
+    size_t node = 1;
+
+    player.pos = path[0];
+    player.heading = heading;
+
+    for (uint64_t now = FrameMs; now < TimeoutMs; now += FrameMs)
+    {
+        const Pos aim = steer ? PursuitPoint(player.pos, path, node) : path[node];
+        const float difference = player.HeadingDifference(aim);
+
+        Keys keys{};
+
+        keys.turn = steer ? steering.Turn(difference, Distance(player.pos, aim), player.heading, ToleranceYaw * 2, now) : BangBang(difference, ToleranceYaw * 2);
+        keys.forward = true;
+
+        player.Press(keys, now);
+        player.Step(now);
+
+        // THE SAME NODE SWITCH AS THE PATROL STATE
+        if (std::sqrt(Distance(path[node], player.pos)) < RangeNextPath && ++node == path.size())
+        {
+            return Result{ double(now) / 1000, double(player.transitions), double(player.yalms), true };
+        }
+    }
+
+    return Result{ double(TimeoutMs) / 1000, double(player.transitions), double(player.yalms), false };
+}
+
+static void Report(const char* name, const std::vector<Result>& results)
+{
+    double seconds = 0;
+    double transitions = 0;
+    double yalms = 0;
+    uint32_t arrived = 0;
+
+    for (const Result& r : results)
+    {
+        seconds += r.seconds;
+        transitions += r.transitions;
+        yalms += r.yalms;
+        arrived += r.arrived;
+    }
+
+    const double runs = double(results.size());
+
+    std::printf("  %-10s %6.2f s to arrive %7.2f transitions %6.3f transitions/yalm %5u/%zu arrived\n", name, seconds / runs, transitions / runs, transitions / yalms, arrived, results.size());
+}
+
+int main(int argc, char** argv)
+{
+    const uint32_t runs = argc > 1 ? std::max(1u, uint32_t(std::strtoul(argv[1], nullptr, 10))) : 500;
+    const uint32_t seed = argc > 2 ? uint32_t(std::strtoul(argv[2], nullptr, 10)) : 1;
+
+    std::mt19937 random(seed);
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+
+    std::vector<Result> chase_bang, chase_steer, patrol_bang, patrol_steer;
+
+    for (uint32_t run = 0; run < runs; run++)
+    {
+        const Pos goal{ unit(random) * 40, unit(random) * 40 };
+        const float heading = unit(random) * 3.14159265f;
+
+        chase_bang.push_back(Chase(false, goal, heading));
+        chase_steer.push_back(Chase(true, goal, heading));
+
+        // A WANDERING PATH, NODES 4 TO 12 YALMS APART
+        std::vector<Pos> path{ Pos{ 0, 0 } };
+        float direction = unit(random) * 3.14159265f;
+
+        for (uint32_t n = 0; n < 12; n++)
+        {
+            const float length = 8.0f + unit(random) * 4.0f;
+
+            direction += unit(random) * 1.2f;
+            path.push_back(Pos{ path.back().x + std::cos(direction) * length, path.back().y - std::sin(direction) * length });
+        }
+
+        patrol_bang.push_back(Patrol(false, path, direction));
+        patrol_steer.push_back(Patrol(true, path, direction));
+    }
+
+    std::printf("%u runs, %.1f rad/s turns, %.1f yalms/s, %llu ms key latency, %llu ms frames\n\n", runs, TurnRate, Speed, (unsigned long long)Steering::Lead, (unsigned long long)FrameMs);
+
+    std::printf("chase\n");
+    Report("bang-bang", chase_bang);
+    Report("steering", chase_steer);
+
+    std::printf("patrol\n");
+    Report("bang-bang", patrol_bang);
+    Report("steering", patrol_steer);
+
+    return 0;
+}
@@ -0,0 +1,178 @@
+/**
+ * Stockpile Zone Hop Check
+ *
+ * Loads hundreds of synthetic zones one after the other into a zone context backed by the zone arena, the way
+ * Stockpile::ZoneReset, Stockpile::LoadMobDatData, Stockpile::DecodeNames and Stockpile::FilterTargets do (see
+ * ZoneArena.h), and reports the used and resident zone memory and the process resident size as it goes.
+ *
+ * Zone memory is released as a whole on every hop, so the footprint must stay flat however many zones are visited.
+ *
+ * Usage:
+ *
+ *      zonehop [hops] [seed]
+ *
+ * Exits with 1 if the process resident size grew by more than a zone block between the 10th and the last hop.
+ * (Linux only, elsewhere only the zone memory is reported.)
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <optional>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../Matcher.h"
+#include "../MobTable.h"
+#include "../NameArena.h"
+#include "../NameIndex.h"
+#include "../ZoneArena.h"
+
+static constexpr size_t ZoneBlock = 256 * 1024;     // The same as Stockpile::zone_arena.
+
+// THE SAME AS Stockpile::ZoneContext
+struct ZoneContext
+{
+    MobTable mob_table;
+    NameArena unique_names;
+    NameIndex name_index;
+    std::pmr::vector<int> filtered;
+
+    explicit ZoneContext(std::pmr::memory_resource* resource)
+        : mob_table(resource)
+        , unique_names(resource)
+        , name_index(resource)
+        , filtered(resource)
+    {}
+};
+
+/**
+ * @return {long} The process resident size in KB, -1 where it cannot be read.
+ */
+static long ResidentKB()
+{
+#if defined(__linux__)
+    FILE* f = std::fopen("/proc/self/statm", "r");
+    long pages = 0, resident = -1;
+
+    if (f != nullptr)
+    {
+        if (std::fscanf(f, "%ld %ld", &pages, &resident) != 2)
+        {
+            resident = -1;
+        }
+
+        std::fclose(f);
+    }
+
+    return resident < 0 ? -1 : resident * 4;
+#else
+    return -1;
+#endif
+}
+
+static void LoadZone(ZoneContext& zone, const Matcher& matcher, uint32_t hop, uint32_t records, std::mt19937& random)
+{
+    static const char* stems[] = { "Goblin", "Orcish", "Yagudo", "Quadav", "Land", "Bee", "Forest", "Cave", "Giant", "Mad" };
+    static const char* kinds[] = { "Thug", "Pathfinder", "Fodder", "Crab", "Soldier", "Hare", "Bat", "Leech", "Worm", "Bats" };
+
+    // LoadMobDatData, THE DAT READ STRAIGHT INTO THE TABLE
+    char* dat = zone.mob_table.Prepare(size_t(records) * MobTable::RecordSize);
+
+    for (uint32_t n = 0; n < records; n++)
+    {
+        char* record = dat + size_t(n) * MobTable::RecordSize;
+        const uint32_t name = random() % 400;
+
+        std::snprintf(record, MobTable::NameSize, "%s %s %u", stems[name % 10], kinds[name / 10 % 10], name / 100);
+
+        const uint32_t server_id = 0x01000000 | ((hop & 0x7F) << 12) | (n % MobTable::Slots);
+        std::memcpy(record + MobTable::NameSize, &server_id, sizeof(server_id));
+    }
+
+    zone.mob_table.Index([](std::string_view name) { return name == "???" || name == "none"; });
+    zone.mob_table.Classify(matcher);
+
+    // DecodeNames, THE FIRST TIME THE TARGETS PANEL IS OPEN
+    zone.unique_names.Reserve(zone.mob_table.NameCount(), zone.mob_table.NameCount() * MobTable::NameSize);
+
+    for (size_t n = 0; n < zone.mob_table.NameCount(); n++)
+    {
+        zone.unique_names.Add(zone.mob_table.NameAt(uint16_t(n)));
+    }
+
+    zone.unique_names.Sort();
+    zone.name_index.Build(zone.unique_names);
+
+    // FilterTargets, AN EMPTY SEARCH SHOWS EVERY NAME
+    zone.filtered.reserve(zone.unique_names.size());
+
+    zone.name_index.Query("", [&](uint32_t n)
+    {
+        if (!(matcher.Classify(zone.unique_names[n]) & Matcher::Banned))
+        {
+            zone.filtered.push_back(int(n));
+        }
+    });
+}
+
+int main(int argc, char** argv)
+{
+    const uint32_t hops = argc > 1 ? std::max(10u, uint32_t(std::strtoul(argv[1], nullptr, 10))) : 500;
+    const uint32_t seed = argc > 2 ? uint32_t(std::strtoul(argv[2], nullptr, 10)) : 1;
+
+    std::mt19937 random(seed);
+
+    Matcher matcher;
+    matcher.Compile({ "Goblin*", "*Crab*" }, { ",", ".", "#", "Moogle" });
+
+    ZoneArena arena(ZoneBlock);
+    std::optional<ZoneContext> zone{ std::in_place, &arena };
+
+    size_t min_used = SIZE_MAX;
+    size_t max_used = 0;
+    long settled = -1;
+
+    for (uint32_t hop = 1; hop <= hops; hop++)
+    {
+        // ZoneReset
+        zone.reset();
+        arena.Release();
+        zone.emplace(&arena);
+
+        const uint32_t records = 200 + random() % 2800;
+
+        LoadZone(*zone, matcher, hop, records, random);
+
+        min_used = std::min(min_used, arena.Used());
+        max_used = std::max(max_used, arena.Used());
+
+        const long resident = ResidentKB();
+
+        if (hop == 10)
+        {
+            settled = resident;
+        }
+
+        if (hop == 1 || hop == 10 || hop % 100 == 0 || hop == hops)
+        {
+            std::printf("hop %4u %4u records %4zu names, zone %4zu KB used %4zu KB resident, process %6ld KB resident\n", hop, records, zone->unique_names.size(), arena.Used() / 1024, arena.Resident() / 1024, resident);
+        }
+    }
+
+    std::printf("\nzone used %zu - %zu KB, peak %zu KB, block %zu KB\n", min_used / 1024, max_used / 1024, arena.Peak() / 1024, arena.Capacity() / 1024);
+
+    const long resident = ResidentKB();
+
+    if (settled >= 0 && resident >= 0 && resident - settled > long(ZoneBlock / 1024))
+    {
+        std::fprintf(stderr, "Process resident size grew from %ld KB at hop 10 to %ld KB.\n", settled, resident);
+        return 1;
+    }
+
+    return 0;
+}